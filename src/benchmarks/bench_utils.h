@@ -0,0 +1,36 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_BENCHMARKS_BENCH_UTILS_H_
+#define SRC_BENCHMARKS_BENCH_UTILS_H_
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace s21 {
+namespace bench {
+
+// Runs func once and prints its wall time in milliseconds
+template <class F>
+double measure(const std::string &label, F &&func) {
+  auto start = std::chrono::steady_clock::now();
+  func();
+  std::chrono::duration<double, std::milli> elapsed =
+      std::chrono::steady_clock::now() - start;
+  std::cout << "  " << label << ": " << elapsed.count() << " ms" << std::endl;
+  return elapsed.count();
+}
+
+// Element count from the first command line argument or the fallback
+inline size_t element_count(int argc, char **argv, size_t fallback) {
+  if (argc > 1) {
+    return std::strtoull(argv[1], nullptr, 10);
+  }
+  return fallback;
+}
+
+}  // namespace bench
+}  // namespace s21
+
+#endif  // SRC_BENCHMARKS_BENCH_UTILS_H_
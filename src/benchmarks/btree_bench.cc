@@ -0,0 +1,66 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <map>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_utils.h"
+
+namespace {
+
+// Keys in a scattered order, so neighbours in the tree are not neighbours
+// in insertion order
+long long scattered(size_t i, size_t count) {
+  return static_cast<long long>(i * 2654435761ULL % count);
+}
+
+template <class Map>
+void run(const char *name, size_t count) {
+  std::cout << name << std::endl;
+  long long checksum = 0;
+
+  Map map;
+  s21::bench::measure("insert scattered", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      map.insert({scattered(i, count), static_cast<long long>(i)});
+    }
+  });
+  s21::bench::measure("find every key in scattered order", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      checksum += (*map.find(scattered(i * 7 + 3, count))).second;
+    }
+  });
+  s21::bench::measure("lower_bound of absent keys", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      auto found = map.lower_bound(scattered(i, count) +
+                                   static_cast<long long>(count));
+      checksum += found == map.end() ? 1 : 0;
+    }
+  });
+  s21::bench::measure("full scan", [&] {
+    for (auto it = map.begin(); it != map.end(); ++it) {
+      checksum += (*it).second;
+    }
+  });
+  s21::bench::measure("erase half", [&] {
+    for (size_t i = 0; i < count; i += 2) {
+      map.erase(map.find(scattered(i, count)));
+    }
+  });
+
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 1'000'000);
+  std::cout << "Ordered maps with " << count << " integer keys" << std::endl;
+
+  run<s21::map<long long, long long>>("s21::map", count);
+  run<s21::btree_map<long long, long long>>("s21::btree_map", count);
+  run<std::map<long long, long long>>("std::map", count);
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_utils.h"
+
+namespace {
+
+// The baseline: one s21::map behind one mutex, as callers did before
+class locked_map {
+ public:
+  bool insert_or_assign(long long key, long long obj) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.insert_or_assign(key, obj).second;
+  }
+
+  bool contains(long long key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+ private:
+  mutable std::mutex mutex_ = std::mutex();
+  s21::map<long long, long long> map_ = s21::map<long long, long long>();
+};
+
+long long scattered(size_t i, size_t count) {
+  return static_cast<long long>(i * 2654435761ULL % count);
+}
+
+// Every thread does operations / threads steps, one write in ten
+template <class Map>
+void run(const char *name, size_t count, size_t max_threads) {
+  std::cout << name << std::endl;
+  size_t operations = count * 4;
+
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    Map map;
+    for (size_t i = 0; i < count; ++i) {
+      map.insert_or_assign(scattered(i, count), static_cast<long long>(i));
+    }
+
+    std::vector<long long> hits(threads);
+    std::string label = std::to_string(threads) + " thread(s), 90% reads";
+    s21::bench::measure(label, [&] {
+      std::vector<std::thread> workers;
+      for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+          long long local_hits = 0;
+          for (size_t i = t; i < operations; i += threads) {
+            long long key = scattered(i * 7 + 3, count);
+            if (i % 10 == 0) {
+              map.insert_or_assign(key, static_cast<long long>(i));
+            } else {
+              local_hits += map.contains(key) ? 1 : 0;
+            }
+          }
+          hits[t] = local_hits;
+        });
+      }
+      for (std::thread &worker : workers) {
+        worker.join();
+      }
+    });
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 200'000);
+  size_t cores = std::thread::hardware_concurrency();
+  size_t max_threads = cores == 0 ? 1 : cores;
+  std::cout << "Shared maps with " << count << " keys, up to " << max_threads
+            << " threads" << std::endl;
+
+  run<locked_map>("s21::map behind one mutex", count, max_threads);
+  run<s21::concurrent_map<long long, long long>>("s21::concurrent_map", count,
+                                                 max_threads);
+
+  return 0;
+}
@@ -0,0 +1,47 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_utils.h"
+
+namespace {
+
+// Half of the probes hit: keys are the even numbers below 2 * count
+long long probe(size_t i, size_t count) {
+  return static_cast<long long>(i * 2654435761ULL % (count * 2));
+}
+
+template <class Set>
+void run(const char *name, const Set &lookup, size_t count) {
+  long long hits = 0;
+  s21::bench::measure(name, [&] {
+    for (size_t i = 0; i < count * 4; ++i) {
+      hits += lookup.contains(probe(i, count)) ? 1 : 0;
+    }
+  });
+  std::cout << "  hits: " << hits << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 1'000'000);
+  std::cout << "contains on " << count << " integer keys, " << count * 4
+            << " probes" << std::endl;
+
+  s21::set<long long> tree;
+  s21::flat_set<long long> flat;
+  for (size_t i = 0; i < count; ++i) {
+    tree.insert(tree.end(), static_cast<long long>(i * 2));
+  }
+  flat.bulk_load(tree.begin(), tree.end(), s21::kSorted);
+  s21::frozen_set<long long> frozen = tree.freeze();
+
+  run("s21::set", tree, count);
+  run("s21::flat_set", flat, count);
+  run("s21::frozen_set", frozen, count);
+
+  return 0;
+}
@@ -0,0 +1,64 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <unordered_map>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_utils.h"
+
+namespace {
+
+long long scattered(size_t i, size_t count) {
+  return static_cast<long long>(i * 2654435761ULL % count);
+}
+
+template <class Map>
+void run(const char *name, size_t count) {
+  std::cout << name << std::endl;
+  long long checksum = 0;
+
+  Map map;
+  s21::bench::measure("insert scattered", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      map.insert({scattered(i, count), static_cast<long long>(i)});
+    }
+  });
+  s21::bench::measure("find every key in scattered order", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      checksum += (*map.find(scattered(i * 7 + 3, count))).second;
+    }
+  });
+  s21::bench::measure("find absent keys", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      auto found =
+          map.find(scattered(i, count) + static_cast<long long>(count));
+      checksum += found == map.end() ? 1 : 0;
+    }
+  });
+  s21::bench::measure("erase half", [&] {
+    for (size_t i = 0; i < count; i += 2) {
+      map.erase(map.find(scattered(i, count)));
+    }
+  });
+  s21::bench::measure("find after erase", [&] {
+    for (size_t i = 1; i < count; i += 2) {
+      checksum += (*map.find(scattered(i, count))).second;
+    }
+  });
+
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 1'000'000);
+  std::cout << "Point lookups with " << count << " integer keys" << std::endl;
+
+  run<s21::map<long long, long long>>("s21::map", count);
+  run<s21::unordered_map<long long, long long>>("s21::unordered_map", count);
+  run<std::unordered_map<long long, long long>>("std::unordered_map", count);
+
+  return 0;
+}
@@ -0,0 +1,52 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <map>
+
+#include "../s21_containers.h"
+#include "bench_utils.h"
+
+namespace {
+
+template <class Map>
+void run(const char *name, size_t count, int passes) {
+  std::cout << name << std::endl;
+  Map map;
+  for (size_t i = 0; i < count; ++i) {
+    map.insert({static_cast<int>(i * 7 % count), static_cast<int>(i)});
+  }
+
+  long long checksum = 0;
+  s21::bench::measure("full in-order scans", [&] {
+    for (int pass = 0; pass < passes; ++pass) {
+      for (auto it = map.begin(); it != map.end(); ++it) {
+        checksum += (*it).second;
+      }
+    }
+  });
+  s21::bench::measure("full reverse scans", [&] {
+    for (int pass = 0; pass < passes; ++pass) {
+      auto it = map.end();
+      for (size_t i = 0; i < map.size(); ++i) {
+        --it;
+        checksum += (*it).first;
+      }
+    }
+  });
+
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 1'000'000);
+  const int passes = 10;
+  std::cout << passes << " scans of a map with " << count << " elements"
+            << std::endl;
+
+  run<s21::map<int, int>>("s21::map", count, passes);
+  run<std::map<int, int>>("std::map", count, passes);
+
+  return 0;
+}
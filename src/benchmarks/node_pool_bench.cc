@@ -0,0 +1,62 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <map>
+
+#include "../s21_containers.h"
+#include "bench_utils.h"
+
+namespace {
+
+// Keys in a scattered order, so neighbours in the tree are not neighbours
+// in insertion order
+long long scattered(size_t i, size_t count) {
+  return static_cast<long long>(i * 2654435761ULL % count);
+}
+
+template <class Map>
+void run(const char *name, size_t count) {
+  std::cout << name << std::endl;
+  long long checksum = 0;
+
+  {
+    Map map;
+    s21::bench::measure("insert scattered", [&] {
+      for (size_t i = 0; i < count; ++i) {
+        map.insert({scattered(i, count), static_cast<long long>(i)});
+      }
+    });
+    s21::bench::measure("churn: erase and reinsert a tenth, 5 rounds", [&] {
+      for (size_t round = 0; round < 5; ++round) {
+        for (size_t i = round; i < count; i += 10) {
+          map.erase(map.find(scattered(i, count)));
+        }
+        for (size_t i = round; i < count; i += 10) {
+          map.insert({scattered(i, count), static_cast<long long>(round)});
+        }
+      }
+    });
+    s21::bench::measure("full scan", [&] {
+      for (auto it = map.begin(); it != map.end(); ++it) {
+        checksum += (*it).second;
+      }
+    });
+    s21::bench::measure("teardown", [&] { map.clear(); });
+  }
+
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 10'000'000);
+  std::cout << "Node allocation with " << count << " keys" << std::endl;
+
+  run<s21::map<long long, long long>>("s21::map heap nodes", count);
+  run<s21::map<long long, long long, std::less<long long>,
+               s21::pool_node_allocator>>("s21::map pool nodes", count);
+  run<std::map<long long, long long>>("std::map", count);
+
+  return 0;
+}
@@ -0,0 +1,71 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+#include "bench_utils.h"
+
+namespace {
+
+long long scattered(size_t i, size_t count) {
+  return static_cast<long long>(i * 2654435761ULL % count);
+}
+
+// A writer updating the map and handing a consistent view to readers
+// after every hundredth update
+void run_map(size_t count, size_t updates) {
+  std::cout << "s21::map, snapshot by copy" << std::endl;
+  s21::map<long long, long long> map;
+  for (size_t i = 0; i < count; ++i) {
+    map.insert(scattered(i, count), static_cast<long long>(i));
+  }
+
+  long long checksum = 0;
+  s21::bench::measure("updates with a snapshot every 100", [&] {
+    for (size_t i = 0; i < updates; ++i) {
+      map.insert_or_assign(scattered(i * 7 + 3, count),
+                           static_cast<long long>(i));
+      if (i % 100 == 0) {
+        s21::map<long long, long long> snapshot(map);
+        checksum += static_cast<long long>(snapshot.size());
+      }
+    }
+  });
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+void run_persistent(size_t count, size_t updates) {
+  std::cout << "s21::persistent_map, snapshot by version" << std::endl;
+  s21::persistent_map<long long, long long> map;
+  for (size_t i = 0; i < count; ++i) {
+    map = map.insert(scattered(i, count), static_cast<long long>(i));
+  }
+
+  long long checksum = 0;
+  s21::bench::measure("updates with a snapshot every 100", [&] {
+    for (size_t i = 0; i < updates; ++i) {
+      map = map.insert_or_assign(scattered(i * 7 + 3, count),
+                                 static_cast<long long>(i));
+      if (i % 100 == 0) {
+        s21::persistent_map<long long, long long> snapshot(map);
+        checksum += static_cast<long long>(snapshot.size());
+      }
+    }
+  });
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 200'000);
+  size_t updates = 100'000;
+  std::cout << "Snapshots of " << count << " keys during " << updates
+            << " updates" << std::endl;
+
+  run_map(count, updates);
+  run_persistent(count, updates);
+
+  return 0;
+}
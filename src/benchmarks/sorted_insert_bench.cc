@@ -0,0 +1,61 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <map>
+
+#include "../s21_containers.h"
+#include "bench_utils.h"
+
+namespace {
+
+template <class Map>
+void run(const char *name, size_t count) {
+  std::cout << name << std::endl;
+  long long checksum = 0;
+  Map map;
+
+  s21::bench::measure("insert sorted", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      map.insert({static_cast<long long>(i), static_cast<long long>(i)});
+    }
+  });
+  s21::bench::measure("find every key", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      checksum += map.at(static_cast<long long>(i));
+    }
+  });
+
+  std::cout << "  size: " << map.size() << ", checksum: " << checksum
+            << std::endl;
+}
+
+void run_bulk(size_t count) {
+  std::cout << "s21::map bulk" << std::endl;
+  s21::vector<std::pair<long long, long long>> items;
+  items.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    items.push_back({static_cast<long long>(i), static_cast<long long>(i)});
+  }
+
+  s21::map<long long, long long> map;
+  s21::bench::measure("bulk_load sorted", [&] {
+    map.bulk_load(items.begin(), items.end(), s21::kSorted);
+  });
+  s21::bench::measure("copy construct", [&] {
+    s21::map<long long, long long> copy(map);
+    std::cout << "  copied: " << copy.size() << std::endl;
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 10'000'000);
+  std::cout << "Sorted insert of " << count << " keys" << std::endl;
+
+  run<s21::map<long long, long long>>("s21::map", count);
+  run<std::map<long long, long long>>("std::map", count);
+  run_bulk(count);
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+// Copyright 2023 school-21
+
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <new>
+#include <string>
+#include <string_view>
+
+#include "../s21_containers.h"
+#include "bench_utils.h"
+
+namespace {
+
+size_t allocations = 0;
+
+// Longer than the small string buffer, so every copy hits the heap
+std::string make_key(size_t i) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof(buffer), "sensor/%012zu/temperature", i);
+  return buffer;
+}
+
+template <class Map, class Key>
+void run(const char *name, const Map &map, const s21::vector<Key> &keys) {
+  size_t found = 0;
+  size_t before = 0;
+  s21::bench::measure(name, [&] {
+    before = allocations;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      found += map.count(keys[i]);
+    }
+  });
+  std::cout << "    allocations per lookup: "
+            << static_cast<double>(allocations - before) /
+                   static_cast<double>(keys.size())
+            << ", found: " << found << std::endl;
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  ++allocations;
+  if (void *memory = std::malloc(size)) {
+    return memory;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 1'000'000);
+  std::cout << count << " lookups of std::string keys" << std::endl;
+
+  s21::map<std::string, int, std::less<>> s21_map;
+  std::map<std::string, int, std::less<>> std_map;
+  s21::vector<std::string> keys;
+  s21::vector<std::string_view> views;
+  for (size_t i = 0; i < count; ++i) {
+    keys.push_back(make_key(i * 7));
+  }
+  for (size_t i = 0; i < count; ++i) {
+    s21_map.insert(keys[i], static_cast<int>(i));
+    std_map.emplace(keys[i], static_cast<int>(i));
+    views.push_back(keys[i]);
+  }
+
+  run("s21::map, std::string key", s21_map, keys);
+  run("s21::map, std::string_view key", s21_map, views);
+  run("std::map, std::string key", std_map, keys);
+  run("std::map, std::string_view key", std_map, views);
+
+  return 0;
+}
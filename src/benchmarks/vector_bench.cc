@@ -0,0 +1,90 @@
+// Copyright 2023 school-21
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "bench_utils.h"
+
+namespace {
+
+bool rejected(const std::string &value) { return value[0] % 3 == 0; }
+
+size_t erase_rejected(s21::vector<std::string> &strings) {
+  return s21::erase_if(strings, rejected);
+}
+
+size_t erase_rejected(std::vector<std::string> &strings) {
+  auto kept_end = std::remove_if(strings.begin(), strings.end(), rejected);
+  auto count = size_t(strings.end() - kept_end);
+  strings.erase(kept_end, strings.end());
+  return count;
+}
+
+template <class Vector>
+Vector make_strings(size_t count) {
+  Vector strings;
+  for (size_t i = 0; i < count; ++i) {
+    strings.push_back(std::string(24, char('a' + i % 26)));
+  }
+  return strings;
+}
+
+template <class Vector>
+void run(const char *name, size_t count) {
+  std::cout << name << std::endl;
+  size_t checksum = 0;
+
+  s21::bench::measure("reserve strings", [&] {
+    Vector strings;
+    strings.reserve(count);
+    checksum += strings.capacity();
+  });
+  s21::bench::measure("push_back strings", [&] {
+    Vector strings;
+    for (size_t i = 0; i < count; ++i) {
+      strings.push_back(std::string(24, char('a' + i % 26)));
+    }
+    checksum += strings.size();
+  });
+
+  // single erases shift the tail each time, so this runs on a hundredth
+  Vector few = make_strings<Vector>(count / 100);
+  s21::bench::measure("erase one by one (1/100 of strings)", [&] {
+    for (size_t i = 0; i < few.size();) {
+      if (rejected(few[i])) {
+        few.erase(few.begin() + long(i));
+      } else {
+        ++i;
+      }
+    }
+    checksum += few.size();
+  });
+  Vector all = make_strings<Vector>(count);
+  s21::bench::measure("erase_if strings", [&] {
+    checksum += erase_rejected(all);
+  });
+  Vector sink = make_strings<Vector>(count / 2);
+  Vector source = make_strings<Vector>(count / 2);
+  s21::bench::measure("range insert in the middle", [&] {
+    sink.insert(sink.begin() + long(sink.size() / 2), source.begin(),
+                source.end());
+    checksum += sink.size();
+  });
+
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 1'000'000);
+  std::cout << "Vectors of " << count << " elements" << std::endl;
+
+  run<s21::vector<std::string>>("s21::vector", count);
+  run<std::vector<std::string>>("std::vector", count);
+
+  return 0;
+}
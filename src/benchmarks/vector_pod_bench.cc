@@ -0,0 +1,90 @@
+// Copyright 2023 school-21
+
+#include <iostream>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "bench_utils.h"
+
+namespace {
+
+struct point {
+  double x;
+  double y;
+  long long id;
+};
+
+// Not trivially copyable for the compiler, but its bytes may be moved:
+// opted in below
+struct handle {
+  handle() = default;
+  explicit handle(long long id) : id_(id) {}
+  handle(const handle &other) : id_(other.id_) {}
+  handle &operator=(const handle &other) {
+    id_ = other.id_;
+    return *this;
+  }
+  ~handle() {}
+
+  long long id_ = 0;
+  long long padding_[2] = {};
+};
+
+template <class T>
+T make(size_t i) {
+  return T(static_cast<long long>(i));
+}
+
+template <>
+point make<point>(size_t i) {
+  return point{double(i), double(i), static_cast<long long>(i)};
+}
+
+template <class Vector>
+void run(const char *name, size_t count) {
+  using value_type = typename Vector::value_type;
+  std::cout << name << std::endl;
+  size_t checksum = 0;
+
+  Vector values;
+  s21::bench::measure("push_back with growth", [&] {
+    for (size_t i = 0; i < count; ++i) {
+      values.push_back(make<value_type>(i));
+    }
+  });
+  s21::bench::measure("copy assignment", [&] {
+    Vector copy;
+    copy = values;
+    checksum += copy.size();
+  });
+  s21::bench::measure("10 inserts and erases at the front", [&] {
+    for (size_t i = 0; i < 10; ++i) {
+      values.insert(values.begin(), make<value_type>(i));
+    }
+    for (size_t i = 0; i < 10; ++i) {
+      values.erase(values.begin());
+    }
+    checksum += values.size();
+  });
+
+  std::cout << "  checksum: " << checksum << std::endl;
+}
+
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<handle> : std::true_type {};
+
+int main(int argc, char **argv) {
+  size_t count = s21::bench::element_count(argc, argv, 10'000'000);
+  std::cout << "Vectors of " << count << " elements" << std::endl;
+
+  run<s21::vector<int>>("s21::vector<int>", count);
+  run<std::vector<int>>("std::vector<int>", count);
+  run<s21::vector<point>>("s21::vector<point>", count);
+  run<std::vector<point>>("std::vector<point>", count);
+  run<s21::vector<handle>>("s21::vector<handle>", count);
+  run<std::vector<handle>>("std::vector<handle>", count);
+
+  return 0;
+}
@@ -0,0 +1,18 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_S21_CONTAINERSPLUS_H_
+#define SRC_S21_CONTAINERSPLUS_H_
+
+#include "source/btree_map.h"
+#include "source/btree_set.h"
+#include "source/concurrent_map.h"
+#include "source/flat_map.h"
+#include "source/flat_set.h"
+#include "source/frozen_set.h"
+#include "source/multimap.h"
+#include "source/multiset.h"
+#include "source/persistent_map.h"
+#include "source/unordered_map.h"
+#include "source/unordered_set.h"
+
+#endif  // SRC_S21_CONTAINERSPLUS_H_
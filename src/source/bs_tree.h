@@ -6,14 +6,22 @@
 #include <cstdlib>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+#include "container.h"
+#include "node_allocator.h"
 #include "tree_node.h"
 
 namespace s21 {
-template <class V, class K, class T>  // V must be class(contain node_ and
-                                      // key_type key()), K - key_type
+
+// V must be class(contain value_ and const key_type &key()), K - key_type,
+// Compare - strict weak ordering of keys, Alloc - node allocator from
+// node_allocator.h
+template <class V, class K, class T, class Compare = std::less<K>,
+          template <class> class Alloc = heap_node_allocator>
 class bs_tree {
  public:
   using value_type = V;
@@ -25,6 +33,38 @@ class bs_tree {
   using const_iterator = typename tree_node<V, K, T>::TreeConstIterator;
   using size_type = size_t;
 
+  // Owns a node detached from a tree by extract(), so it can be relinked
+  // into another tree by insert_unique(node_type &&) without a copy
+  class TreeNodeHandle {
+   public:
+    TreeNodeHandle() noexcept = default;
+    TreeNodeHandle(const TreeNodeHandle &other) = delete;
+    TreeNodeHandle(TreeNodeHandle &&other) noexcept;
+    TreeNodeHandle &operator=(const TreeNodeHandle &other) = delete;
+    TreeNodeHandle &operator=(TreeNodeHandle &&other) noexcept;
+    ~TreeNodeHandle() noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+    explicit operator bool() const noexcept;
+    obj_type &value() const noexcept;
+
+   private:
+    friend class bs_tree;
+    TreeNodeHandle(tree_node<V, K, T> *node,
+                   const Alloc<tree_node<V, K, T>> &alloc) noexcept;
+
+    tree_node<V, K, T> *node_ = nullptr;
+    Alloc<tree_node<V, K, T>> alloc_ = Alloc<tree_node<V, K, T>>();
+  };
+
+  using node_type = TreeNodeHandle;
+
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
   bs_tree() noexcept = default;
   bs_tree(std::initializer_list<value_type> const &items);
   bs_tree(const bs_tree &other);
@@ -45,172 +85,1211 @@ class bs_tree {
 
   void clear() noexcept;
   iterator insert(const value_type &value);
+  std::pair<iterator, bool> insert_unique(const value_type &value);
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  // hint is the element the new one goes before, a correct hint links the
+  // node next to it without a descent from the root. key may refer into
+  // args: it is only read before the node is built from them
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace_hint(iterator hint,
+                                             const key_type &key,
+                                             Args &&...args);
+  insert_return_type insert_unique(node_type &&node);
   void erase(iterator pos);
+  node_type extract(iterator pos);
   void swap(bs_tree &other) noexcept;
-  void merge(bs_tree &other);
+  void merge_unique(bs_tree &other);
+  void merge_equal(bs_tree &other);
+  template <class Key>
+  size_type erase_equal(const Key &key);
+
+  // Replaces the content with a perfectly balanced tree in O(n)
+  template <class ForwardIt>
+  void bulk_load(ForwardIt first, ForwardIt last, sorted_tag);
 
-  iterator find(const key_type &key) const noexcept;
-  [[nodiscard]] bool contains(const key_type &key) const noexcept;
+  // Lookup accepts any Key comparable with key_type by Compare
+  template <class Key>
+  iterator find(const Key &key) const;
+  template <class Key>
+  [[nodiscard]] bool contains(const Key &key) const;
+  template <class Key>
+  iterator lower_bound(const Key &key) const;
+  template <class Key>
+  iterator upper_bound(const Key &key) const;
+  template <class Key>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+  template <class Key>
+  [[nodiscard]] size_type count(const Key &key) const;
+
+  // Order statistics over subtree sizes, both O(log n)
+  iterator nth(size_type k) const;
+  template <class Key>
+  [[nodiscard]] size_type rank(const Key &key) const;
+
+  Compare key_comp() const;
 
  private:
-  tree_node<value_type, key_type, obj_type> *root_ = nullptr;
+  using tree_node_type = tree_node<value_type, key_type, obj_type>;
+  using node_allocator = Alloc<tree_node_type>;
+
+  // Sentinel: parent is the root, left and right are the leftmost and the
+  // rightmost nodes, so the bounds of the tree are known without a walk.
+  // The root points back to it and it serves as the end iterator. Default
+  // red colour tells it apart from the root
+  tree_node_type header_ = tree_node_type();
+  size_type size_ = 0;
+  Compare compare_ = Compare();
+  node_allocator node_alloc_ = node_allocator();
+
+  tree_node_type *root() const noexcept;
+  void set_root(tree_node_type *node) noexcept;
+  tree_node_type *leftmost() const noexcept;
+  tree_node_type *rightmost() const noexcept;
+  void reset_header() noexcept;
+  // Where a node with key belongs, the unique search also reports the node
+  // already holding an equal key
+  struct insert_position {
+    tree_node_type *parent;
+    bool as_left;
+    tree_node_type *equal;
+  };
+
+  template <class Key>
+  insert_position find_equal_position(const Key &key);
+  template <class Key>
+  insert_position find_unique_position(const Key &key);
+  template <class Key>
+  insert_position find_hint_position(iterator hint, const Key &key);
+  iterator link_node(tree_node_type *node, tree_node_type *parent,
+                     bool as_left) noexcept;
+  tree_node_type *unlink(iterator pos);
+  tree_node_type *adopt(tree_node_type *node, node_allocator &owner);
+  tree_node_type *take_node(bs_tree &other, iterator pos);
+  void clone(const bs_tree &other);
+  template <class ForwardIt>
+  tree_node_type *build_balanced(ForwardIt &it, size_type count,
+                                 size_type depth, size_type red_depth);
+
+  // Red-black balancing helpers
+  static bool is_red(const tree_node_type *node) noexcept;
+  static void update_size(tree_node_type *node) noexcept;
+  void rotate_left(tree_node_type *node) noexcept;
+  void rotate_right(tree_node_type *node) noexcept;
+  void transplant(tree_node_type *from, tree_node_type *to) noexcept;
+  void insert_fixup(tree_node_type *node) noexcept;
+  void erase_fixup(tree_node_type *node, tree_node_type *parent) noexcept;
 };
 
-template <class V, class K, class T>
-bs_tree<V, K, T>::bs_tree(std::initializer_list<value_type> const &items) {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::bs_tree(
+    std::initializer_list<value_type> const &items) {
   for (const auto &elem : items) {
     insert(elem);
   }
 }
 
-template <class V, class K, class T>
-bs_tree<V, K, T>::bs_tree(const bs_tree &other) {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::bs_tree(const bs_tree &other) {
   *this = other;
 }
 
-template <class V, class K, class T>
-bs_tree<V, K, T>::bs_tree(bs_tree &&other) noexcept {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::bs_tree(bs_tree &&other) noexcept {
   *this = std::move(other);
 }
 
-template <class V, class K, class T>
-bs_tree<V, K, T>::bs_tree(const value_type &value) noexcept {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::bs_tree(const value_type &value) noexcept {
   insert(value);
 }
 
-template <class V, class K, class T>
-bs_tree<V, K, T>::~bs_tree() noexcept {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::~bs_tree() noexcept {
   clear();
 }
 
-template <class V, class K, class T>
-bs_tree<V, K, T> &bs_tree<V, K, T>::operator=(const bs_tree &other) {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc> &bs_tree<V, K, T, Compare, Alloc>::operator=(
+    const bs_tree &other) {
   if (this == &other) {
     return *this;
   }
 
   clear();
-
-  for (iterator b = other.begin(); b != other.end(); ++b) {
-    insert(*b);
-  }
+  compare_ = other.compare_;
+  clone(other);
 
   return *this;
 }
 
-template <class V, class K, class T>
-bs_tree<V, K, T> &bs_tree<V, K, T>::operator=(bs_tree &&other) noexcept {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc> &bs_tree<V, K, T, Compare, Alloc>::operator=(
+    bs_tree &&other) noexcept {
   if (this == &other) {
     return *this;
   }
 
   clear();
 
-  root_ = std::exchange(other.root_, nullptr);
+  set_root(other.root());
+  header_.set_left(other.leftmost());
+  header_.set_right(other.rightmost());
+  size_ = std::exchange(other.size_, 0);
+  compare_ = other.compare_;
+  node_alloc_ = std::move(other.node_alloc_);
+  other.reset_header();
 
   return *this;
 }
 
-template <class V, class K, class T>
-typename bs_tree<V, K, T>::iterator bs_tree<V, K, T>::begin() const noexcept {
-  if (!root_) {
-    return iterator(nullptr, true);
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::begin() const noexcept {
+  if (empty()) {
+    return end();
   }
 
-  return iterator(root_->front(), false);
+  return iterator(leftmost());
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::end() const noexcept {
+  return iterator(const_cast<tree_node_type *>(&header_));
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+[[nodiscard]] bool bs_tree<V, K, T, Compare, Alloc>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+[[nodiscard]] typename bs_tree<V, K, T, Compare, Alloc>::size_type
+bs_tree<V, K, T, Compare, Alloc>::size() const noexcept {
+  return size_;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+[[nodiscard]] typename bs_tree<V, K, T, Compare, Alloc>::size_type
+bs_tree<V, K, T, Compare, Alloc>::max_size() const noexcept {
+  return size_type(-1) / sizeof(tree_node<V, K, T>);
 }
 
-template <class V, class K, class T>
-typename bs_tree<V, K, T>::iterator bs_tree<V, K, T>::end() const noexcept {
-  if (!root_) {
-    return iterator(nullptr, true);
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::clear() noexcept {
+  // a pool drops trivially destructible nodes without visiting them, if no
+  // node handle or other tree holds one of its nodes
+  if constexpr (node_allocator::kBulkRelease &&
+                std::is_trivially_destructible_v<tree_node_type>) {
+    if (node_alloc_.alive() == size_) {
+      node_alloc_.release(size_);
+      reset_header();
+      size_ = 0;
+      return;
+    }
   }
 
-  return iterator(root_->back(), true);
+  // Iterative post-order teardown: descend to a leaf, unlink it from its
+  // parent, destroy it and continue from the parent
+  tree_node_type *node = root();
+  while (node != nullptr && node != &header_) {
+    if (node->get_left()) {
+      node = node->get_left();
+    } else if (node->get_right()) {
+      node = node->get_right();
+    } else {
+      tree_node_type *parent = node->get_parent();
+      if (parent != &header_) {
+        if (parent->get_left() == node) {
+          parent->set_left(nullptr);
+        } else {
+          parent->set_right(nullptr);
+        }
+      }
+      node_alloc_.destroy(node);
+      node = parent;
+    }
+  }
+
+  reset_header();
+  size_ = 0;
 }
 
-template <class V, class K, class T>
-[[nodiscard]] bool bs_tree<V, K, T>::empty() const noexcept {
-  return root_ == nullptr;
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::insert(const value_type &value) {
+  insert_position position = find_equal_position(value.key());
+  return link_node(node_alloc_.create(value), position.parent,
+                   position.as_left);
 }
 
-template <class V, class K, class T>
-[[nodiscard]] typename bs_tree<V, K, T>::size_type bs_tree<V, K, T>::size()
-    const noexcept {
-  if (!root_) {
-    return 0;
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+std::pair<typename bs_tree<V, K, T, Compare, Alloc>::iterator, bool>
+bs_tree<V, K, T, Compare, Alloc>::insert_unique(const value_type &value) {
+  return try_emplace(value.key(), value);
+}
+
+// Single descent: the value is constructed from args only if key is absent,
+// otherwise the iterator to the present element is returned
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class... Args>
+std::pair<typename bs_tree<V, K, T, Compare, Alloc>::iterator, bool>
+bs_tree<V, K, T, Compare, Alloc>::try_emplace(const key_type &key,
+                                              Args &&...args) {
+  insert_position position = find_unique_position(key);
+  if (position.equal) {
+    return std::pair<iterator, bool>(iterator(position.equal), false);
+  }
+
+  tree_node_type *node =
+      node_alloc_.create(value_type(std::forward<Args>(args)...));
+  return std::pair<iterator, bool>(
+      link_node(node, position.parent, position.as_left), true);
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class... Args>
+std::pair<typename bs_tree<V, K, T, Compare, Alloc>::iterator, bool>
+bs_tree<V, K, T, Compare, Alloc>::try_emplace_hint(iterator hint,
+                                                   const key_type &key,
+                                                   Args &&...args) {
+  insert_position position = find_hint_position(hint, key);
+  if (position.equal) {
+    return std::pair<iterator, bool>(iterator(position.equal), false);
+  }
+
+  tree_node_type *node =
+      node_alloc_.create(value_type(std::forward<Args>(args)...));
+  return std::pair<iterator, bool>(
+      link_node(node, position.parent, position.as_left), true);
+}
+
+// On failure the handle is given back in the result
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::insert_return_type
+bs_tree<V, K, T, Compare, Alloc>::insert_unique(node_type &&node) {
+  if (node.empty()) {
+    return insert_return_type{end(), false, node_type()};
+  }
+
+  insert_position position =
+      find_unique_position(node.node_->get_value().key());
+  if (position.equal) {
+    return insert_return_type{iterator(position.equal), false,
+                              std::move(node)};
+  }
+
+  tree_node_type *released = node.node_;
+  if (!(node.alloc_ == node_alloc_)) {
+    released = adopt(released, node.alloc_);
   }
-  return root_->size();
+  node.node_ = nullptr;
+  return insert_return_type{
+      link_node(released, position.parent, position.as_left), true,
+      node_type()};
 }
 
-template <class V, class K, class T>
-[[nodiscard]] typename bs_tree<V, K, T>::size_type bs_tree<V, K, T>::max_size()
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::erase(iterator pos) {
+  node_alloc_.destroy(unlink(pos));
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::node_type
+bs_tree<V, K, T, Compare, Alloc>::extract(iterator pos) {
+  return node_type(unlink(pos), node_alloc_);
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::TreeNodeHandle(
+    tree_node<V, K, T> *node, const Alloc<tree_node<V, K, T>> &alloc) noexcept
+    : node_(node), alloc_(alloc) {}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::TreeNodeHandle(
+    TreeNodeHandle &&other) noexcept
+    : node_(std::exchange(other.node_, nullptr)),
+      alloc_(std::move(other.alloc_)) {}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle &
+bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::operator=(
+    TreeNodeHandle &&other) noexcept {
+  if (this != &other) {
+    if (node_ != nullptr) {
+      alloc_.destroy(node_);
+    }
+    node_ = std::exchange(other.node_, nullptr);
+    alloc_ = std::move(other.alloc_);
+  }
+  return *this;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::~TreeNodeHandle() noexcept {
+  if (node_ != nullptr) {
+    alloc_.destroy(node_);
+  }
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bool bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::empty() const noexcept {
+  return node_ == nullptr;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::operator bool()
     const noexcept {
-  return size_type(-1) / sizeof(tree_node<V, K, T>);
+  return node_ != nullptr;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::obj_type &
+bs_tree<V, K, T, Compare, Alloc>::TreeNodeHandle::value() const noexcept {
+  return node_->get_value().value_;
 }
 
-template <class V, class K, class T>
-void bs_tree<V, K, T>::clear() noexcept {
-  delete root_;
-  root_ = nullptr;
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::swap(bs_tree &other) noexcept {
+  tree_node_type *other_root = other.root();
+  tree_node_type *other_leftmost = other.leftmost();
+  tree_node_type *other_rightmost = other.rightmost();
+
+  other.set_root(root());
+  other.header_.set_left(leftmost());
+  other.header_.set_right(rightmost());
+
+  set_root(other_root);
+  header_.set_left(other_leftmost);
+  header_.set_right(other_rightmost);
+
+  std::swap(size_, other.size_);
+  std::swap(compare_, other.compare_);
+  std::swap(node_alloc_, other.node_alloc_);
 }
 
-template <class V, class K, class T>
-typename bs_tree<V, K, T>::iterator bs_tree<V, K, T>::insert(
-    const typename bs_tree<V, K, T>::value_type &value) {
-  if (!root_) {
-    root_ = new tree_node<value_type, key_type, obj_type>(value);
-    return iterator(root_);
+// Moves nodes with keys absent here from other by relinking them: nothing is
+// allocated or copied, duplicates stay in other
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::merge_unique(bs_tree &other) {
+  if (this == &other) {
+    return;
   }
 
-  return root_->insert(value);
+  for (iterator elem = other.begin(); elem != other.end();) {
+    iterator next = elem;
+    ++next;
+
+    insert_position position =
+        find_unique_position(elem.get_node()->get_value().key());
+    if (!position.equal) {
+      link_node(take_node(other, elem), position.parent, position.as_left);
+    }
+
+    elem = next;
+  }
 }
 
-template <class V, class K, class T>
-void bs_tree<V, K, T>::erase(iterator pos) {
-  if (!root_) {
-    throw std::out_of_range("Already empty");
-  } else if (pos == end()) {
-    throw std::out_of_range("End erase");
-  } else if (pos.get_node() == root_ && !root_->get_right() &&
-             !root_->get_left()) {
-    delete root_;
-    root_ = nullptr;
-  } else {
-    root_->erase(pos);
+// Moves every node of other here, equal keys keep their relative order
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::merge_equal(bs_tree &other) {
+  if (this == &other) {
+    return;
+  }
+
+  while (!other.empty()) {
+    iterator elem = other.begin();
+    insert_position position =
+        find_equal_position(elem.get_node()->get_value().key());
+    link_node(take_node(other, elem), position.parent, position.as_left);
   }
 }
 
-template <class V, class K, class T>
-void bs_tree<V, K, T>::swap(bs_tree &other) noexcept {
-  std::swap(root_, other.root_);
+// Removes all elements with key, returns their number
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::size_type
+bs_tree<V, K, T, Compare, Alloc>::erase_equal(const Key &key) {
+  std::pair<iterator, iterator> range = equal_range(key);
+  size_type erased = 0;
+  while (range.first != range.second) {
+    iterator next = range.first;
+    ++next;
+    erase(range.first);
+    range.first = next;
+    ++erased;
+  }
+  return erased;
 }
 
-template <class V, class K, class T>
-void bs_tree<V, K, T>::merge(bs_tree &other) {
-  for (iterator elem = other.begin(); elem != other.end(); ++elem) {
-    insert(*elem);
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class ForwardIt>
+void bs_tree<V, K, T, Compare, Alloc>::bulk_load(ForwardIt first,
+                                                 ForwardIt last, sorted_tag) {
+  clear();
+
+  auto count = static_cast<size_type>(std::distance(first, last));
+  if (count == 0) {
+    return;
+  }
+
+  // All levels but the deepest one are full: painting the deepest level red
+  // keeps the black height equal on every path
+  size_type red_depth = 0;
+  while ((count >> (red_depth + 1)) != 0) {
+    ++red_depth;
+  }
+
+  set_root(build_balanced(first, count, 0, red_depth));
+  root()->set_color(node_color::kBlack);
+  size_ = count;
+
+  tree_node_type *node = root();
+  while (node->get_left()) {
+    node = node->get_left();
+  }
+  header_.set_left(node);
+
+  node = root();
+  while (node->get_right()) {
+    node = node->get_right();
   }
+  header_.set_right(node);
 }
 
-template <class V, class K, class T>
-typename bs_tree<V, K, T>::iterator bs_tree<V, K, T>::find(
-    const key_type &key) const noexcept {
-  if (!root_) {
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::find(const Key &key) const {
+  iterator found = lower_bound(key);
+  if (found == end() || compare_(key, found.get_node()->get_value().key())) {
     return end();
   }
-  typename tree_node<value_type, key_type, obj_type>::iterator it =
-      root_->find(key);
-  if (it == nullptr) {
+  return found;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+[[nodiscard]] bool bs_tree<V, K, T, Compare, Alloc>::contains(
+    const Key &key) const {
+  return find(key) != end();
+}
+
+// First element whose key is not less than key
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::lower_bound(const Key &key) const {
+  tree_node_type *result = const_cast<tree_node_type *>(&header_);
+  for (tree_node_type *node = root(); node != nullptr;) {
+    if (!compare_(node->get_value().key(), key)) {
+      result = node;
+      node = node->get_left();
+    } else {
+      node = node->get_right();
+    }
+  }
+  return iterator(result);
+}
+
+// First element whose key is greater than key
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::upper_bound(const Key &key) const {
+  tree_node_type *result = const_cast<tree_node_type *>(&header_);
+  for (tree_node_type *node = root(); node != nullptr;) {
+    if (compare_(key, node->get_value().key())) {
+      result = node;
+      node = node->get_left();
+    } else {
+      node = node->get_right();
+    }
+  }
+  return iterator(result);
+}
+
+// Single descent down to the first node with an equal key, then the bounds
+// are searched in its left and right subtrees only
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+std::pair<typename bs_tree<V, K, T, Compare, Alloc>::iterator,
+          typename bs_tree<V, K, T, Compare, Alloc>::iterator>
+bs_tree<V, K, T, Compare, Alloc>::equal_range(const Key &key) const {
+  tree_node_type *upper = const_cast<tree_node_type *>(&header_);
+  tree_node_type *node = root();
+  while (node != nullptr) {
+    if (compare_(node->get_value().key(), key)) {
+      node = node->get_right();
+    } else if (compare_(key, node->get_value().key())) {
+      upper = node;
+      node = node->get_left();
+    } else {
+      break;
+    }
+  }
+  if (node == nullptr) {
+    return std::pair<iterator, iterator>(iterator(upper), iterator(upper));
+  }
+
+  tree_node_type *lower = node;
+  for (tree_node_type *left = node->get_left(); left != nullptr;) {
+    if (!compare_(left->get_value().key(), key)) {
+      lower = left;
+      left = left->get_left();
+    } else {
+      left = left->get_right();
+    }
+  }
+  for (tree_node_type *right = node->get_right(); right != nullptr;) {
+    if (compare_(key, right->get_value().key())) {
+      upper = right;
+      right = right->get_left();
+    } else {
+      right = right->get_right();
+    }
+  }
+
+  return std::pair<iterator, iterator>(iterator(lower), iterator(upper));
+}
+
+// Keys not greater than key minus keys less than key: O(log n) however
+// many elements are equal
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::size_type
+bs_tree<V, K, T, Compare, Alloc>::count(const Key &key) const {
+  size_type not_greater = 0;
+  for (tree_node_type *node = root(); node != nullptr;) {
+    if (compare_(key, node->get_value().key())) {
+      node = node->get_left();
+    } else {
+      not_greater += tree_node_type::subtree_size(node->get_left()) + 1;
+      node = node->get_right();
+    }
+  }
+  return not_greater - rank(key);
+}
+
+// Element at position k in order, end() if k >= size()
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::nth(size_type k) const {
+  if (k >= size_) {
     return end();
   }
-  return iterator(it);
+  return iterator(tree_node_type::select(root(), k));
 }
 
-template <class V, class K, class T>
-[[nodiscard]] bool bs_tree<V, K, T>::contains(
-    const key_type &key) const noexcept {
-  return find(key) != end();
+// Number of elements whose key is less than key
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::size_type
+bs_tree<V, K, T, Compare, Alloc>::rank(const Key &key) const {
+  size_type result = 0;
+  for (tree_node_type *node = root(); node != nullptr;) {
+    if (compare_(node->get_value().key(), key)) {
+      result += tree_node_type::subtree_size(node->get_left()) + 1;
+      node = node->get_right();
+    } else {
+      node = node->get_left();
+    }
+  }
+  return result;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+Compare bs_tree<V, K, T, Compare, Alloc>::key_comp() const {
+  return compare_;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::root() const noexcept {
+  return header_.get_parent();
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::set_root(tree_node_type *node) noexcept {
+  header_.set_parent(node);
+  if (node) {
+    node->set_parent(&header_);
+  }
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::leftmost() const noexcept {
+  return header_.get_left();
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::rightmost() const noexcept {
+  return header_.get_right();
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::reset_header() noexcept {
+  header_.set_parent(nullptr);
+  header_.set_left(nullptr);
+  header_.set_right(nullptr);
+}
+
+// Equal keys go right, after the elements already present
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::insert_position
+bs_tree<V, K, T, Compare, Alloc>::find_equal_position(const Key &key) {
+  tree_node_type *parent = &header_;
+  bool as_left = true;
+  for (tree_node_type *node = root(); node != nullptr;) {
+    parent = node;
+    as_left = compare_(key, node->get_value().key());
+    node = as_left ? node->get_left() : node->get_right();
+  }
+
+  return insert_position{parent, as_left, nullptr};
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::insert_position
+bs_tree<V, K, T, Compare, Alloc>::find_unique_position(const Key &key) {
+  insert_position position = find_equal_position(key);
+
+  // the only candidate for an equal key is the in-order predecessor of the
+  // insert position
+  iterator candidate(position.parent);
+  if (position.as_left) {
+    if (position.parent == &header_ || position.parent == leftmost()) {
+      candidate = end();
+    } else {
+      --candidate;
+    }
+  }
+  if (candidate != end() &&
+      !compare_(candidate.get_node()->get_value().key(), key)) {
+    position.equal = candidate.get_node();
+  }
+
+  return position;
+}
+
+// A key right after the hint moves the hint one step forward. The key fits
+// if it lies between the hint and its predecessor, then it goes to the free
+// one of the predecessor's right and the hint's left child: one or two
+// comparisons instead of a descent. A wrong hint costs the usual search
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class Key>
+typename bs_tree<V, K, T, Compare, Alloc>::insert_position
+bs_tree<V, K, T, Compare, Alloc>::find_hint_position(iterator hint,
+                                                     const Key &key) {
+  if (empty()) {
+    return find_unique_position(key);
+  }
+
+  tree_node_type *next = hint.get_node();
+  if (next != &header_ && !compare_(key, next->get_value().key())) {
+    if (!compare_(next->get_value().key(), key)) {
+      return insert_position{next, false, next};
+    }
+    next = (++hint).get_node();
+    if (next != &header_ && !compare_(key, next->get_value().key())) {
+      return find_unique_position(key);
+    }
+  }
+
+  if (next == leftmost()) {
+    return insert_position{next, true, nullptr};
+  }
+  tree_node_type *prev = (--hint).get_node();
+  if (!compare_(prev->get_value().key(), key)) {
+    if (!compare_(key, prev->get_value().key())) {
+      return insert_position{prev, false, prev};
+    }
+    return find_unique_position(key);
+  }
+
+  if (prev->get_right() == nullptr) {
+    return insert_position{prev, false, nullptr};
+  }
+  return insert_position{next, true, nullptr};
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::iterator
+bs_tree<V, K, T, Compare, Alloc>::link_node(tree_node_type *node,
+                                            tree_node_type *parent,
+                                            bool as_left) noexcept {
+  if (parent == &header_) {
+    set_root(node);
+    header_.set_left(node);
+    header_.set_right(node);
+  } else if (as_left) {
+    parent->set_left(node);
+    node->set_parent(parent);
+    if (parent == leftmost()) {
+      header_.set_left(node);
+    }
+  } else {
+    parent->set_right(node);
+    node->set_parent(parent);
+    if (parent == rightmost()) {
+      header_.set_right(node);
+    }
+  }
+  ++size_;
+  for (; parent != &header_; parent = parent->get_parent()) {
+    parent->set_size(parent->get_size() + 1);
+  }
+
+  insert_fixup(node);
+  return iterator(node);
+}
+
+// Copies the shape and colours of other node by node without comparisons.
+// Walks both trees in step over parent links, so no recursion is needed
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::clone(const bs_tree &other) {
+  if (other.empty()) {
+    return;
+  }
+
+  tree_node_type *source = other.root();
+  tree_node_type *target = node_alloc_.create(source->get_value());
+  target->set_color(source->get_color());
+  target->set_size(source->get_size());
+  set_root(target);
+  header_.set_left(target);
+  header_.set_right(target);
+
+  while (true) {
+    tree_node_type *child = nullptr;
+    if (source->get_left() && !target->get_left()) {
+      source = source->get_left();
+      child = node_alloc_.create(source->get_value(), target);
+      target->set_left(child);
+    } else if (source->get_right() && !target->get_right()) {
+      source = source->get_right();
+      child = node_alloc_.create(source->get_value(), target);
+      target->set_right(child);
+    } else if (source != other.root()) {
+      source = source->get_parent();
+      target = target->get_parent();
+      continue;
+    } else {
+      break;
+    }
+
+    child->set_color(source->get_color());
+    child->set_size(source->get_size());
+    if (source == other.leftmost()) {
+      header_.set_left(child);
+    }
+    if (source == other.rightmost()) {
+      header_.set_right(child);
+    }
+    target = child;
+  }
+
+  size_ = other.size_;
+}
+
+// Builds count nodes from it in order: the middle element becomes the
+// subtree root, so sizes of the halves differ by one at most
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+template <class ForwardIt>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::build_balanced(ForwardIt &it,
+                                                 size_type count,
+                                                 size_type depth,
+                                                 size_type red_depth) {
+  if (count == 0) {
+    return nullptr;
+  }
+
+  size_type left_count = (count - 1) / 2;
+  tree_node_type *left = build_balanced(it, left_count, depth + 1, red_depth);
+
+  tree_node_type *node = node_alloc_.create(value_type(*it));
+  ++it;
+  node->set_color(depth == red_depth ? node_color::kRed : node_color::kBlack);
+  node->set_left(left);
+  if (left) {
+    left->set_parent(node);
+  }
+
+  tree_node_type *right =
+      build_balanced(it, count - 1 - left_count, depth + 1, red_depth);
+  node->set_right(right);
+  if (right) {
+    right->set_parent(node);
+  }
+  node->set_size(count);
+
+  return node;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+bool bs_tree<V, K, T, Compare, Alloc>::is_red(
+    const tree_node_type *node) noexcept {
+  return node != nullptr && node->get_color() == node_color::kRed;
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::update_size(
+    tree_node_type *node) noexcept {
+  node->set_size(tree_node_type::subtree_size(node->get_left()) +
+                 tree_node_type::subtree_size(node->get_right()) + 1);
+}
+
+// Rotations keep subtree sizes: the pivot takes over the size of the node
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::rotate_left(
+    tree_node_type *node) noexcept {
+  tree_node_type *pivot = node->get_right();
+
+  node->set_right(pivot->get_left());
+  if (pivot->get_left()) {
+    pivot->get_left()->set_parent(node);
+  }
+
+  transplant(node, pivot);
+  pivot->set_left(node);
+  node->set_parent(pivot);
+
+  pivot->set_size(node->get_size());
+  update_size(node);
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::rotate_right(
+    tree_node_type *node) noexcept {
+  tree_node_type *pivot = node->get_left();
+
+  node->set_left(pivot->get_right());
+  if (pivot->get_right()) {
+    pivot->get_right()->set_parent(node);
+  }
+
+  transplant(node, pivot);
+  pivot->set_right(node);
+  node->set_parent(pivot);
+
+  pivot->set_size(node->get_size());
+  update_size(node);
+}
+
+// Puts 'to' on the place of 'from' in the parent of 'from'
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::transplant(tree_node_type *from,
+                                                  tree_node_type *to) noexcept {
+  tree_node_type *parent = from->get_parent();
+  if (parent == &header_) {
+    set_root(to);
+  } else if (parent->get_left() == from) {
+    parent->set_left(to);
+  } else {
+    parent->set_right(to);
+  }
+
+  if (to) {
+    to->set_parent(parent);
+  }
+}
+
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::insert_fixup(
+    tree_node_type *node) noexcept {
+  while (node != root() && is_red(node->get_parent())) {
+    tree_node_type *parent = node->get_parent();
+    tree_node_type *grandparent = parent->get_parent();
+
+    if (parent == grandparent->get_left()) {
+      tree_node_type *uncle = grandparent->get_right();
+      if (is_red(uncle)) {
+        parent->set_color(node_color::kBlack);
+        uncle->set_color(node_color::kBlack);
+        grandparent->set_color(node_color::kRed);
+        node = grandparent;
+        continue;
+      }
+      if (node == parent->get_right()) {
+        rotate_left(parent);
+        node = parent;
+        parent = node->get_parent();
+      }
+      parent->set_color(node_color::kBlack);
+      grandparent->set_color(node_color::kRed);
+      rotate_right(grandparent);
+    } else {
+      tree_node_type *uncle = grandparent->get_left();
+      if (is_red(uncle)) {
+        parent->set_color(node_color::kBlack);
+        uncle->set_color(node_color::kBlack);
+        grandparent->set_color(node_color::kRed);
+        node = grandparent;
+        continue;
+      }
+      if (node == parent->get_left()) {
+        rotate_right(parent);
+        node = parent;
+        parent = node->get_parent();
+      }
+      parent->set_color(node_color::kBlack);
+      grandparent->set_color(node_color::kRed);
+      rotate_left(grandparent);
+    }
+  }
+
+  root()->set_color(node_color::kBlack);
+}
+
+// Detaches the node at pos from other to link it here: relinked as is when
+// both trees share the allocator, otherwise its value is moved to a new node
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::take_node(bs_tree &other, iterator pos) {
+  tree_node_type *node = pos.get_node();
+  if (node_alloc_ == other.node_alloc_) {
+    return other.unlink(pos);
+  }
+
+  tree_node_type *moved = node_alloc_.create(std::move(node->get_value()));
+  other.erase(pos);
+  return moved;
+}
+
+// Moves the value of a node owned by another allocator into a node of this
+// tree, the original node is destroyed by its owner
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::adopt(tree_node_type *node,
+                                        node_allocator &owner) {
+  tree_node_type *adopted = node_alloc_.create(std::move(node->get_value()));
+  owner.destroy(node);
+  return adopted;
+}
+
+// Detaches the node at pos and rebalances; the caller takes ownership
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+typename bs_tree<V, K, T, Compare, Alloc>::tree_node_type *
+bs_tree<V, K, T, Compare, Alloc>::unlink(iterator pos) {
+  if (!root()) {
+    throw std::out_of_range("Already empty");
+  } else if (pos == end()) {
+    throw std::out_of_range("End erase");
+  }
+
+  tree_node_type *node = pos.get_node();
+  if (node == leftmost()) {
+    tree_node_type *next = node->get_parent();
+    if (node->get_right()) {
+      next = node->get_right();
+      while (next->get_left()) {
+        next = next->get_left();
+      }
+    }
+    header_.set_left(next);
+  }
+  if (node == rightmost()) {
+    tree_node_type *prev = node->get_parent();
+    if (node->get_left()) {
+      prev = node->get_left();
+      while (prev->get_right()) {
+        prev = prev->get_right();
+      }
+    }
+    header_.set_right(prev);
+  }
+
+  // node leaves its place or, having two children, the successor takes it:
+  // every ancestor of the place left empty loses one node
+  tree_node_type *vacated = node;
+  if (node->get_left() && node->get_right()) {
+    vacated = node->get_right();
+    while (vacated->get_left()) {
+      vacated = vacated->get_left();
+    }
+  }
+  for (tree_node_type *parent = vacated->get_parent(); parent != &header_;
+       parent = parent->get_parent()) {
+    parent->set_size(parent->get_size() - 1);
+  }
+
+  tree_node_type *replacement = nullptr;
+  tree_node_type *replacement_parent = nullptr;
+  node_color removed_color = node->get_color();
+
+  if (!node->get_left()) {
+    replacement = node->get_right();
+    replacement_parent = node->get_parent();
+    transplant(node, replacement);
+  } else if (!node->get_right()) {
+    replacement = node->get_left();
+    replacement_parent = node->get_parent();
+    transplant(node, replacement);
+  } else {
+    tree_node_type *successor = vacated;
+    removed_color = successor->get_color();
+    replacement = successor->get_right();
+
+    if (successor->get_parent() == node) {
+      replacement_parent = successor;
+    } else {
+      replacement_parent = successor->get_parent();
+      transplant(successor, replacement);
+      successor->set_right(node->get_right());
+      successor->get_right()->set_parent(successor);
+    }
+
+    transplant(node, successor);
+    successor->set_left(node->get_left());
+    successor->get_left()->set_parent(successor);
+    successor->set_color(node->get_color());
+    successor->set_size(node->get_size());
+  }
+
+  node->set_left(nullptr);
+  node->set_right(nullptr);
+  node->set_parent(nullptr);
+  node->set_color(node_color::kRed);
+  node->set_size(1);
+  if (--size_ == 0) {
+    reset_header();
+  }
+
+  if (removed_color == node_color::kBlack) {
+    erase_fixup(replacement, replacement_parent);
+  }
+
+  return node;
+}
+
+// 'node' carries an extra black and may be nullptr, so its parent is passed
+template <class V, class K, class T, class Compare,
+          template <class> class Alloc>
+void bs_tree<V, K, T, Compare, Alloc>::erase_fixup(
+    tree_node_type *node, tree_node_type *parent) noexcept {
+  while (node != root() && !is_red(node)) {
+    if (node == parent->get_left()) {
+      tree_node_type *sibling = parent->get_right();
+      if (is_red(sibling)) {
+        sibling->set_color(node_color::kBlack);
+        parent->set_color(node_color::kRed);
+        rotate_left(parent);
+        sibling = parent->get_right();
+      }
+      if (!is_red(sibling->get_left()) && !is_red(sibling->get_right())) {
+        sibling->set_color(node_color::kRed);
+        node = parent;
+        parent = node->get_parent();
+        continue;
+      }
+      if (!is_red(sibling->get_right())) {
+        sibling->get_left()->set_color(node_color::kBlack);
+        sibling->set_color(node_color::kRed);
+        rotate_right(sibling);
+        sibling = parent->get_right();
+      }
+      sibling->set_color(parent->get_color());
+      parent->set_color(node_color::kBlack);
+      sibling->get_right()->set_color(node_color::kBlack);
+      rotate_left(parent);
+    } else {
+      tree_node_type *sibling = parent->get_left();
+      if (is_red(sibling)) {
+        sibling->set_color(node_color::kBlack);
+        parent->set_color(node_color::kRed);
+        rotate_right(parent);
+        sibling = parent->get_left();
+      }
+      if (!is_red(sibling->get_left()) && !is_red(sibling->get_right())) {
+        sibling->set_color(node_color::kRed);
+        node = parent;
+        parent = node->get_parent();
+        continue;
+      }
+      if (!is_red(sibling->get_left())) {
+        sibling->get_right()->set_color(node_color::kBlack);
+        sibling->set_color(node_color::kRed);
+        rotate_left(sibling);
+        sibling = parent->get_left();
+      }
+      sibling->set_color(parent->get_color());
+      parent->set_color(node_color::kBlack);
+      sibling->get_left()->set_color(node_color::kBlack);
+      rotate_right(parent);
+    }
+    node = root();
+  }
+
+  if (node) {
+    node->set_color(node_color::kBlack);
+  }
 }
 
 }  // namespace s21
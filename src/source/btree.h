@@ -0,0 +1,598 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_BTREE_H_
+#define SRC_SOURCE_BTREE_H_
+
+#include <cstdlib>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "btree_node.h"
+
+namespace s21 {
+
+// Ordered unique keys in a B-tree: a lookup touches O(log n / log M) nodes
+// of M values each instead of O(log n) scattered single-value nodes.
+// V must be class(contain value_ and const key_type &key()), K - key_type,
+// Compare - strict weak ordering of keys.
+// Values move between nodes on insert and erase, so unlike bs_tree both
+// invalidate all iterators
+template <class V, class K, class T, class Compare = std::less<K>>
+class btree {
+ public:
+  using value_type = V;
+  using key_type = K;
+  using obj_type = T;
+  using iterator = typename btree_node<V, K, T>::iterator;
+  using const_iterator = typename btree_node<V, K, T>::const_iterator;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  btree() noexcept = default;
+  btree(const btree &other);
+  btree(btree &&other) noexcept;
+
+  ~btree() noexcept;
+
+  btree &operator=(const btree &other);
+  btree &operator=(btree &&other) noexcept;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept;
+  [[nodiscard]] size_type size() const noexcept;
+  [[nodiscard]] size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  // The value is constructed from args only if key is absent, otherwise
+  // the iterator to the present element is returned
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  // hint is the element the new one goes before, a correct hint skips the
+  // descent. key may refer into args: it is only read before the value is
+  // stored in a node
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace_hint(iterator hint,
+                                             const key_type &key,
+                                             Args &&...args);
+  void erase(iterator pos);
+  void swap(btree &other) noexcept;
+  // Moves the values with keys absent here out of other
+  void merge_unique(btree &other);
+
+  // Lookup accepts any Key comparable with key_type by Compare
+  template <class Key>
+  iterator find(const Key &key) const;
+  template <class Key>
+  [[nodiscard]] bool contains(const Key &key) const;
+  template <class Key>
+  iterator lower_bound(const Key &key) const;
+  template <class Key>
+  iterator upper_bound(const Key &key) const;
+  template <class Key>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  Compare key_comp() const;
+
+ private:
+  using node_type = btree_node<value_type, key_type, obj_type>;
+
+  node_type *root_ = nullptr;
+  // the first and the last leaves, begin() and end() live there
+  node_type *leftmost_ = nullptr;
+  node_type *rightmost_ = nullptr;
+  size_type size_ = 0;
+  Compare compare_ = Compare();
+
+  // Index of the first value of node not less (greater) than key. A linear
+  // scan reads the node front to back, which the hardware prefetcher
+  // follows; binary search probes its cache lines out of order
+  template <class Key>
+  size_type lower_index(const node_type *node, const Key &key) const;
+  template <class Key>
+  size_type upper_index(const node_type *node, const Key &key) const;
+
+  iterator insert_at(node_type *leaf, size_type index, value_type value);
+  void split(node_type *node);
+  void rebalance(node_type *node);
+  static void rotate_left(node_type *parent, size_type index);
+  static void rotate_right(node_type *parent, size_type index);
+  static void merge_children(node_type *parent, size_type index);
+  static node_type *clone(node_type *other);
+  static void destroy_subtree(node_type *node) noexcept;
+  void update_bounds() noexcept;
+};
+
+template <class V, class K, class T, class Compare>
+btree<V, K, T, Compare>::btree(const btree &other) {
+  *this = other;
+}
+
+template <class V, class K, class T, class Compare>
+btree<V, K, T, Compare>::btree(btree &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class V, class K, class T, class Compare>
+btree<V, K, T, Compare>::~btree() noexcept {
+  clear();
+}
+
+template <class V, class K, class T, class Compare>
+btree<V, K, T, Compare> &btree<V, K, T, Compare>::operator=(
+    const btree &other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  clear();
+  compare_ = other.compare_;
+  if (other.root_ != nullptr) {
+    root_ = clone(other.root_);
+    size_ = other.size_;
+    update_bounds();
+  }
+
+  return *this;
+}
+
+template <class V, class K, class T, class Compare>
+btree<V, K, T, Compare> &btree<V, K, T, Compare>::operator=(
+    btree &&other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  clear();
+  root_ = std::exchange(other.root_, nullptr);
+  leftmost_ = std::exchange(other.leftmost_, nullptr);
+  rightmost_ = std::exchange(other.rightmost_, nullptr);
+  size_ = std::exchange(other.size_, 0);
+  compare_ = other.compare_;
+
+  return *this;
+}
+
+template <class V, class K, class T, class Compare>
+typename btree<V, K, T, Compare>::iterator btree<V, K, T, Compare>::begin()
+    const noexcept {
+  return iterator(leftmost_, 0);
+}
+
+template <class V, class K, class T, class Compare>
+typename btree<V, K, T, Compare>::iterator btree<V, K, T, Compare>::end()
+    const noexcept {
+  return iterator(rightmost_,
+                  rightmost_ != nullptr ? rightmost_->get_count() : 0);
+}
+
+template <class V, class K, class T, class Compare>
+bool btree<V, K, T, Compare>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class V, class K, class T, class Compare>
+typename btree<V, K, T, Compare>::size_type btree<V, K, T, Compare>::size()
+    const noexcept {
+  return size_;
+}
+
+template <class V, class K, class T, class Compare>
+typename btree<V, K, T, Compare>::size_type btree<V, K, T, Compare>::max_size()
+    const noexcept {
+  return size_type(-1) / sizeof(value_type);
+}
+
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::clear() noexcept {
+  if (root_ != nullptr) {
+    destroy_subtree(root_);
+  }
+  root_ = nullptr;
+  leftmost_ = nullptr;
+  rightmost_ = nullptr;
+  size_ = 0;
+}
+
+// Single descent: an equal key may sit in any node on the way, a new value
+// always goes into the leaf at the end of it
+template <class V, class K, class T, class Compare>
+template <class... Args>
+std::pair<typename btree<V, K, T, Compare>::iterator, bool>
+btree<V, K, T, Compare>::try_emplace(const key_type &key, Args &&...args) {
+  if (root_ == nullptr) {
+    root_ = node_type::create(true);
+    update_bounds();
+  }
+
+  node_type *node = root_;
+  while (true) {
+    size_type index = lower_index(node, key);
+    if (index < node->get_count() && !compare_(key, node->get_key(index))) {
+      return std::pair<iterator, bool>(iterator(node, index), false);
+    }
+    if (node->is_leaf()) {
+      return std::pair<iterator, bool>(
+          insert_at(node, index, value_type(std::forward<Args>(args)...)),
+          true);
+    }
+    node = node->get_child(index);
+  }
+}
+
+// The key fits before hint if it lies between hint and its predecessor.
+// In a leaf the new value then takes the place of hint, before an inner
+// value it goes right after the predecessor, which is the last value of a
+// leaf. A wrong hint costs the usual descent
+template <class V, class K, class T, class Compare>
+template <class... Args>
+std::pair<typename btree<V, K, T, Compare>::iterator, bool>
+btree<V, K, T, Compare>::try_emplace_hint(iterator hint, const key_type &key,
+                                          Args &&...args) {
+  if (empty()) {
+    return try_emplace(key, std::forward<Args>(args)...);
+  }
+
+  node_type *node = hint.get_node();
+  size_type index = hint.get_position();
+  if (hint != end() && !compare_(key, node->get_key(index))) {
+    return try_emplace(key, std::forward<Args>(args)...);
+  }
+  if (hint != begin()) {
+    iterator prev = hint;
+    --prev;
+    if (!compare_(prev.get_node()->get_key(prev.get_position()), key)) {
+      return try_emplace(key, std::forward<Args>(args)...);
+    }
+    if (!node->is_leaf()) {
+      node = prev.get_node();
+      index = prev.get_position() + 1;
+    }
+  }
+
+  return std::pair<iterator, bool>(
+      insert_at(node, index, value_type(std::forward<Args>(args)...)), true);
+}
+
+// A value in an inner node is replaced by its predecessor from a leaf, so
+// a value is always removed from a leaf
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::erase(iterator pos) {
+  if (root_ == nullptr || size_ == 0) {
+    throw std::out_of_range("Already empty");
+  } else if (pos == end()) {
+    throw std::out_of_range("End erase");
+  }
+
+  node_type *node = pos.get_node();
+  size_type index = pos.get_position();
+  if (!node->is_leaf()) {
+    iterator prev = pos;
+    --prev;
+    node->get_value(index) =
+        std::move(prev.get_node()->get_value(prev.get_position()));
+    node = prev.get_node();
+    index = prev.get_position();
+  }
+
+  node->erase_value(index);
+  --size_;
+  rebalance(node);
+  update_bounds();
+}
+
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::swap(btree &other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(leftmost_, other.leftmost_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(size_, other.size_);
+  std::swap(compare_, other.compare_);
+}
+
+// Values cannot be relinked between B-tree nodes: the absent ones are moved
+// here, the rest is rebuilt in order in other
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::merge_unique(btree &other) {
+  if (this == &other) {
+    return;
+  }
+
+  btree rest;
+  rest.compare_ = other.compare_;
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    value_type &value = it.get_node()->get_value(it.get_position());
+    if (!try_emplace(value.key(), std::move(value)).second) {
+      rest.try_emplace_hint(rest.end(), value.key(), std::move(value));
+    }
+  }
+  other = std::move(rest);
+}
+
+template <class V, class K, class T, class Compare>
+template <class Key>
+typename btree<V, K, T, Compare>::iterator btree<V, K, T, Compare>::find(
+    const Key &key) const {
+  for (node_type *node = root_; node != nullptr;) {
+    size_type index = lower_index(node, key);
+    if (index < node->get_count() && !compare_(key, node->get_key(index))) {
+      return iterator(node, index);
+    }
+    node = node->is_leaf() ? nullptr : node->get_child(index);
+  }
+
+  return end();
+}
+
+template <class V, class K, class T, class Compare>
+template <class Key>
+bool btree<V, K, T, Compare>::contains(const Key &key) const {
+  return find(key) != end();
+}
+
+// Values in child index are all less than the value at index, so a deeper
+// candidate replaces the one found above
+template <class V, class K, class T, class Compare>
+template <class Key>
+typename btree<V, K, T, Compare>::iterator
+btree<V, K, T, Compare>::lower_bound(const Key &key) const {
+  iterator result = end();
+  for (node_type *node = root_; node != nullptr;) {
+    size_type index = lower_index(node, key);
+    if (index < node->get_count()) {
+      result = iterator(node, index);
+    }
+    node = node->is_leaf() ? nullptr : node->get_child(index);
+  }
+
+  return result;
+}
+
+template <class V, class K, class T, class Compare>
+template <class Key>
+typename btree<V, K, T, Compare>::iterator
+btree<V, K, T, Compare>::upper_bound(const Key &key) const {
+  iterator result = end();
+  for (node_type *node = root_; node != nullptr;) {
+    size_type index = upper_index(node, key);
+    if (index < node->get_count()) {
+      result = iterator(node, index);
+    }
+    node = node->is_leaf() ? nullptr : node->get_child(index);
+  }
+
+  return result;
+}
+
+template <class V, class K, class T, class Compare>
+template <class Key>
+std::pair<typename btree<V, K, T, Compare>::iterator,
+          typename btree<V, K, T, Compare>::iterator>
+btree<V, K, T, Compare>::equal_range(const Key &key) const {
+  iterator first = lower_bound(key);
+  iterator last = first;
+  if (last != end() &&
+      !compare_(key, last.get_node()->get_key(last.get_position()))) {
+    ++last;
+  }
+
+  return std::pair<iterator, iterator>(first, last);
+}
+
+template <class V, class K, class T, class Compare>
+Compare btree<V, K, T, Compare>::key_comp() const {
+  return compare_;
+}
+
+template <class V, class K, class T, class Compare>
+template <class Key>
+typename btree<V, K, T, Compare>::size_type
+btree<V, K, T, Compare>::lower_index(const node_type *node,
+                                     const Key &key) const {
+  size_type index = 0;
+  while (index < node->get_count() && compare_(node->get_key(index), key)) {
+    ++index;
+  }
+  return index;
+}
+
+template <class V, class K, class T, class Compare>
+template <class Key>
+typename btree<V, K, T, Compare>::size_type
+btree<V, K, T, Compare>::upper_index(const node_type *node,
+                                     const Key &key) const {
+  size_type index = 0;
+  while (index < node->get_count() && !compare_(key, node->get_key(index))) {
+    ++index;
+  }
+  return index;
+}
+
+// A full leaf is split first; the value then goes to the half that holds
+// its place
+template <class V, class K, class T, class Compare>
+typename btree<V, K, T, Compare>::iterator btree<V, K, T, Compare>::insert_at(
+    node_type *leaf, size_type index, value_type value) {
+  if (leaf->get_count() == node_type::kMaxValues) {
+    split(leaf);
+    size_type middle = leaf->get_count();
+    if (index > middle) {
+      index -= middle + 1;
+      leaf = leaf->get_parent()->get_child(leaf->get_position() + 1);
+    }
+  }
+
+  leaf->insert_value(index, std::move(value), nullptr);
+  ++size_;
+  update_bounds();
+
+  return iterator(leaf, index);
+}
+
+// The upper half of the full node moves to a new right sibling and the
+// middle value goes up between them. A full parent is split first, a split
+// root grows the tree by one level
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::split(node_type *node) {
+  if (node == root_) {
+    root_ = node_type::create(false);
+    root_->set_child(0, node);
+  } else if (node->get_parent()->get_count() == node_type::kMaxValues) {
+    split(node->get_parent());
+  }
+
+  size_type middle = node_type::kMaxValues / 2;
+  node_type *right = node_type::create(node->is_leaf());
+  for (size_type i = middle + 1; i < node->get_count(); ++i) {
+    right->insert_value(right->get_count(), std::move(node->get_value(i)),
+                        node->is_leaf() ? nullptr : node->get_child(i + 1));
+  }
+  if (!node->is_leaf()) {
+    right->set_child(0, node->get_child(middle + 1));
+  }
+
+  value_type separator = std::move(node->get_value(middle));
+  node->truncate(middle);
+  node->get_parent()->insert_value(node->get_position(), std::move(separator),
+                                   right);
+}
+
+// Fills a node left with too few values from a sibling that can spare one,
+// otherwise merges it with a sibling, which may leave the parent short
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::rebalance(node_type *node) {
+  while (node != root_ && node->get_count() < node_type::kMinValues) {
+    node_type *parent = node->get_parent();
+    size_type position = node->get_position();
+    node_type *left = position > 0 ? parent->get_child(position - 1) : nullptr;
+    node_type *right = position < parent->get_count()
+                           ? parent->get_child(position + 1)
+                           : nullptr;
+    if (left != nullptr && left->get_count() > node_type::kMinValues) {
+      rotate_right(parent, position - 1);
+      return;
+    }
+    if (right != nullptr && right->get_count() > node_type::kMinValues) {
+      rotate_left(parent, position);
+      return;
+    }
+    merge_children(parent, left != nullptr ? position - 1 : position);
+    node = parent;
+  }
+
+  if (root_->get_count() == 0) {
+    node_type *old_root = root_;
+    root_ = root_->is_leaf() ? nullptr : root_->get_child(0);
+    if (root_ != nullptr) {
+      root_->detach();
+    }
+    node_type::destroy(old_root);
+  }
+}
+
+// The first value of child index + 1 goes up to the parent, the separator
+// comes down to the end of child index
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::rotate_left(node_type *parent, size_type index) {
+  node_type *left = parent->get_child(index);
+  node_type *right = parent->get_child(index + 1);
+  left->insert_value(left->get_count(),
+                     std::move(parent->get_value(index)),
+                     right->is_leaf() ? nullptr : right->get_child(0));
+  parent->get_value(index) = std::move(right->get_value(0));
+  if (!right->is_leaf()) {
+    right->set_child(0, right->get_child(1));
+  }
+  right->erase_value(0);
+}
+
+// The last value of child index goes up to the parent, the separator comes
+// down to the front of child index + 1
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::rotate_right(node_type *parent,
+                                           size_type index) {
+  node_type *left = parent->get_child(index);
+  node_type *right = parent->get_child(index + 1);
+  right->insert_value(0, std::move(parent->get_value(index)),
+                      right->is_leaf() ? nullptr : right->get_child(0));
+  if (!right->is_leaf()) {
+    right->set_child(0, left->get_child(left->get_count()));
+  }
+  parent->get_value(index) =
+      std::move(left->get_value(left->get_count() - 1));
+  left->truncate(left->get_count() - 1);
+}
+
+// Child index + 1 and the separator before it are appended to child index
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::merge_children(node_type *parent,
+                                             size_type index) {
+  node_type *left = parent->get_child(index);
+  node_type *right = parent->get_child(index + 1);
+  left->insert_value(left->get_count(), std::move(parent->get_value(index)),
+                     right->is_leaf() ? nullptr : right->get_child(0));
+  for (size_type i = 0; i < right->get_count(); ++i) {
+    left->insert_value(left->get_count(), std::move(right->get_value(i)),
+                       right->is_leaf() ? nullptr : right->get_child(i + 1));
+  }
+  parent->erase_value(index);
+  node_type::destroy(right);
+}
+
+template <class V, class K, class T, class Compare>
+typename btree<V, K, T, Compare>::node_type *btree<V, K, T, Compare>::clone(
+    node_type *other) {
+  node_type *node = node_type::create(other->is_leaf());
+  try {
+    if (!other->is_leaf()) {
+      node->set_child(0, clone(other->get_child(0)));
+    }
+    for (size_type i = 0; i < other->get_count(); ++i) {
+      value_type value = other->get_value(i);
+      node_type *child =
+          other->is_leaf() ? nullptr : clone(other->get_child(i + 1));
+      node->insert_value(i, std::move(value), child);
+    }
+  } catch (...) {
+    destroy_subtree(node);
+    throw;
+  }
+
+  return node;
+}
+
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::destroy_subtree(node_type *node) noexcept {
+  // a clone that failed halfway has no children past the copied ones
+  if (node == nullptr) {
+    return;
+  }
+  if (!node->is_leaf()) {
+    for (size_type i = 0; i <= node->get_count(); ++i) {
+      destroy_subtree(node->get_child(i));
+    }
+  }
+  node_type::destroy(node);
+}
+
+template <class V, class K, class T, class Compare>
+void btree<V, K, T, Compare>::update_bounds() noexcept {
+  leftmost_ = root_;
+  rightmost_ = root_;
+  if (root_ == nullptr) {
+    return;
+  }
+  while (!leftmost_->is_leaf()) {
+    leftmost_ = leftmost_->get_child(0);
+  }
+  while (!rightmost_->is_leaf()) {
+    rightmost_ = rightmost_->get_child(rightmost_->get_count());
+  }
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_BTREE_H_
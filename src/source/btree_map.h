@@ -0,0 +1,367 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_BTREE_MAP_H_
+#define SRC_SOURCE_BTREE_MAP_H_
+
+#include <functional>
+#include <tuple>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "btree.h"
+#include "container.h"
+
+namespace s21 {
+
+// map interface over a B-tree: denser and faster to search than map for
+// large key sets. Inserts and erases invalidate all iterators, there are
+// no node handles
+template <class K, class T, class Compare = std::less<K>>
+class btree_map : public container<T> {
+ private:
+  struct KeyTreeNode;
+  using tree_type = btree<KeyTreeNode, K, std::pair<K, T>, Compare>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<K, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+  btree_map() noexcept = default;
+  btree_map(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  btree_map(InputIt first, InputIt last);
+  btree_map(const btree_map &m);
+  btree_map(btree_map &&m) noexcept;
+
+  ~btree_map() noexcept = default;
+
+  btree_map &operator=(const btree_map &m);
+  btree_map &operator=(btree_map &&m) noexcept;
+
+  mapped_type &at(const key_type &key);
+  mapped_type &operator[](const key_type &key);
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  iterator insert(iterator hint, const value_type &value);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+  void erase(iterator pos);
+  void swap(btree_map &other);
+  void merge(btree_map &other);
+
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, enabled for transparent comparators only
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  bool contains(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] size_type count(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  struct KeyTreeNode {
+   public:
+    [[nodiscard]] const key_type &key() const noexcept;
+    KeyTreeNode() noexcept = default;
+    KeyTreeNode(value_type value) noexcept;
+    KeyTreeNode(const key_type &key, const mapped_type &obj);
+    // The mapped value is default constructed in place
+    explicit KeyTreeNode(const key_type &key);
+    value_type value_ = value_type();
+  };
+
+  tree_type tree_ = tree_type();
+};
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare>::btree_map(
+    const std::initializer_list<value_type> &items) {
+  for (auto elem : items) {
+    insert(end(), elem);
+  }
+}
+
+template <class K, class T, class Compare>
+template <class InputIt>
+btree_map<K, T, Compare>::btree_map(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(end(), *first);
+  }
+}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare>::btree_map(const btree_map &m) {
+  *this = m;
+}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare>::btree_map(btree_map &&m) noexcept {
+  *this = std::move(m);
+}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare> &btree_map<K, T, Compare>::operator=(
+    const btree_map &m) {
+  tree_ = m.tree_;
+  return *this;
+}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare> &btree_map<K, T, Compare>::operator=(
+    btree_map &&m) noexcept {
+  tree_ = std::move(m.tree_);
+  return *this;
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::mapped_type &btree_map<K, T, Compare>::at(
+    const key_type &key) {
+  iterator found = tree_.find(key);
+  if (found == end()) {
+    throw std::out_of_range(
+        "Container does not have an element with the specified key");
+  }
+  return (*found).second;
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::mapped_type &
+btree_map<K, T, Compare>::operator[](const key_type &key) {
+  return (*tree_.try_emplace(key, key).first).second;
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::iterator btree_map<K, T, Compare>::begin()
+    const noexcept {
+  return tree_.begin();
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::iterator btree_map<K, T, Compare>::end()
+    const noexcept {
+  return tree_.end();
+}
+
+template <class K, class T, class Compare>
+bool btree_map<K, T, Compare>::empty() const noexcept {
+  return tree_.empty();
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::size_type btree_map<K, T, Compare>::size()
+    const noexcept {
+  return tree_.size();
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::size_type
+btree_map<K, T, Compare>::max_size() const noexcept {
+  return tree_.max_size();
+}
+
+template <class K, class T, class Compare>
+void btree_map<K, T, Compare>::clear() noexcept {
+  tree_.clear();
+}
+
+template <class K, class T, class Compare>
+std::pair<typename btree_map<K, T, Compare>::iterator, bool>
+btree_map<K, T, Compare>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = tree_.try_emplace(value.first, value);
+  if (!result.second) {
+    result.first = tree_.end();
+  }
+  return result;
+}
+
+template <class K, class T, class Compare>
+std::pair<typename btree_map<K, T, Compare>::iterator, bool>
+btree_map<K, T, Compare>::insert(const key_type &key, const mapped_type &obj) {
+  std::pair<iterator, bool> result = tree_.try_emplace(key, key, obj);
+  if (!result.second) {
+    result.first = tree_.end();
+  }
+  return result;
+}
+
+template <class K, class T, class Compare>
+std::pair<typename btree_map<K, T, Compare>::iterator, bool>
+btree_map<K, T, Compare>::insert_or_assign(const key_type &key,
+                                           const mapped_type &obj) {
+  std::pair<iterator, bool> result = tree_.try_emplace(key, key, obj);
+  if (!result.second) {
+    (*result.first).second = obj;
+  }
+  return result;
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::iterator btree_map<K, T, Compare>::insert(
+    iterator hint, const value_type &value) {
+  return tree_.try_emplace_hint(hint, value.first, value).first;
+}
+
+template <class K, class T, class Compare>
+template <class... Args>
+typename btree_map<K, T, Compare>::iterator
+btree_map<K, T, Compare>::emplace_hint(iterator hint, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return tree_.try_emplace_hint(hint, value.first, std::move(value)).first;
+}
+
+template <class K, class T, class Compare>
+void btree_map<K, T, Compare>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <class K, class T, class Compare>
+void btree_map<K, T, Compare>::swap(btree_map &other) {
+  tree_.swap(other.tree_);
+}
+
+// Values with keys absent here are moved from other, the rest stay there
+template <class K, class T, class Compare>
+void btree_map<K, T, Compare>::merge(btree_map &other) {
+  tree_.merge_unique(other.tree_);
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::iterator btree_map<K, T, Compare>::find(
+    const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare>
+bool btree_map<K, T, Compare>::contains(const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::size_type btree_map<K, T, Compare>::count(
+    const key_type &key) const noexcept {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::iterator
+btree_map<K, T, Compare>::lower_bound(const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::iterator
+btree_map<K, T, Compare>::upper_bound(const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare>
+std::pair<typename btree_map<K, T, Compare>::iterator,
+          typename btree_map<K, T, Compare>::iterator>
+btree_map<K, T, Compare>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename btree_map<K, T, Compare>::iterator btree_map<K, T, Compare>::find(
+    const Key &key) const {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+bool btree_map<K, T, Compare>::contains(const Key &key) const {
+  return tree_.contains(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename btree_map<K, T, Compare>::size_type btree_map<K, T, Compare>::count(
+    const Key &key) const {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename btree_map<K, T, Compare>::iterator
+btree_map<K, T, Compare>::lower_bound(const Key &key) const {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename btree_map<K, T, Compare>::iterator
+btree_map<K, T, Compare>::upper_bound(const Key &key) const {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+std::pair<typename btree_map<K, T, Compare>::iterator,
+          typename btree_map<K, T, Compare>::iterator>
+btree_map<K, T, Compare>::equal_range(const Key &key) const {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare>
+typename btree_map<K, T, Compare>::key_compare
+btree_map<K, T, Compare>::key_comp() const {
+  return tree_.key_comp();
+}
+
+template <class K, class T, class Compare>
+const typename btree_map<K, T, Compare>::key_type &
+btree_map<K, T, Compare>::KeyTreeNode::key() const noexcept {
+  return value_.first;
+}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare>::KeyTreeNode::KeyTreeNode(value_type value) noexcept
+    : value_(std::move(value)) {}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare>::KeyTreeNode::KeyTreeNode(const key_type &key,
+                                                   const mapped_type &obj)
+    : value_(key, obj) {}
+
+template <class K, class T, class Compare>
+btree_map<K, T, Compare>::KeyTreeNode::KeyTreeNode(const key_type &key)
+    : value_(std::piecewise_construct, std::forward_as_tuple(key),
+             std::tuple<>()) {}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_BTREE_MAP_H_
@@ -0,0 +1,351 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_BTREE_NODE_H_
+#define SRC_SOURCE_BTREE_NODE_H_
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// V must be class(contains value_ and const key_type &key()), K - key_type.
+// A node keeps up to kMaxValues sorted values in one block of about
+// kNodeBytes, an inner node also keeps count + 1 children after them.
+// Leaves have no child array, so most of a tree is densely packed values.
+// The block is raw storage: only the first count values are objects
+template <class V, class K, class T>
+class btree_node {
+ public:
+  class BTreeIterator;
+  class BTreeConstIterator;
+
+  using value_type = V;
+  using key_type = K;
+  using obj_type = T;
+  using iterator = BTreeIterator;
+  using const_iterator = BTreeConstIterator;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  static constexpr size_type kNodeBytes = 256;
+  static constexpr size_type kMaxValues =
+      sizeof(V) * 3 > kNodeBytes ? 3 : kNodeBytes / sizeof(V);
+  // Every node but the root keeps at least this many values
+  static constexpr size_type kMinValues = (kMaxValues - 1) / 2;
+
+  class BTreeIterator {
+   public:
+    obj_type &operator*();
+    iterator &operator--();
+    iterator &operator++();
+    bool operator==(const iterator &other) const noexcept;
+    bool operator!=(const iterator &other) const noexcept;
+
+    BTreeIterator(btree_node *node, size_type position) noexcept;
+    BTreeIterator() noexcept = default;
+
+    btree_node *get_node() const noexcept;
+    size_type get_position() const noexcept;
+
+   private:
+    // The end iterator is one past the last value of the rightmost leaf
+    btree_node *node_ = nullptr;
+    size_type position_ = 0;
+  };
+
+  class BTreeConstIterator : public BTreeIterator {
+   public:
+    using BTreeIterator::BTreeIterator;
+    const obj_type &operator*();
+  };
+
+  // Nodes are owned and linked by btree
+  btree_node(const btree_node &other) = delete;
+  btree_node &operator=(const btree_node &other) = delete;
+
+  static btree_node *create(bool leaf);
+  // Frees the node alone, its children are left to the caller
+  static void destroy(btree_node *node) noexcept;
+
+  [[nodiscard]] bool is_leaf() const noexcept;
+  size_type get_count() const noexcept;
+  btree_node *get_parent() const noexcept;
+  // Index of the node among the children of its parent
+  size_type get_position() const noexcept;
+  value_type &get_value(size_type index) noexcept;
+  const key_type &get_key(size_type index) const noexcept;
+  btree_node *get_child(size_type index) const noexcept;
+
+  // Destroys the values from count on, e.g. ones moved out by a split
+  void truncate(size_type count) noexcept;
+  void set_child(size_type index, btree_node *child) noexcept;
+  // Makes the node a parentless root
+  void detach() noexcept;
+
+  // Puts value at index and, in an inner node, child right after it,
+  // shifting the tail. The node must not be full
+  void insert_value(size_type index, value_type value, btree_node *child);
+  // Removes the value at index and, in an inner node, the child after it
+  void erase_value(size_type index);
+
+ private:
+  struct inner_node;
+
+  explicit btree_node(bool leaf) noexcept;
+  ~btree_node() noexcept;
+
+  value_type *values() noexcept;
+  const value_type *values() const noexcept;
+
+  btree_node *parent_ = nullptr;
+  unsigned short position_ = 0;
+  unsigned short count_ = 0;
+  bool leaf_ = true;
+  alignas(value_type) unsigned char storage_[sizeof(value_type) * kMaxValues];
+};
+
+template <class V, class K, class T>
+struct btree_node<V, K, T>::inner_node : public btree_node {
+  inner_node() noexcept : btree_node(false) {}
+  inner_node(const inner_node &other) = delete;
+  inner_node &operator=(const inner_node &other) = delete;
+  btree_node *children_[kMaxValues + 1] = {};
+};
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::obj_type &
+btree_node<V, K, T>::iterator::operator*() {
+  return node_->get_value(position_).value_;
+}
+
+template <class V, class K, class T>
+const typename btree_node<V, K, T>::obj_type &
+btree_node<V, K, T>::BTreeConstIterator::operator*() {
+  return this->get_node()->get_value(this->get_position()).value_;
+}
+
+// In an inner node the predecessor is the last value of the rightmost leaf
+// of the left child, in a leaf it is the previous value or the separator of
+// the first ancestor entered from the right
+template <class V, class K, class T>
+typename btree_node<V, K, T>::iterator &
+btree_node<V, K, T>::iterator::operator--() {
+  if (!node_->is_leaf()) {
+    node_ = node_->get_child(position_);
+    while (!node_->is_leaf()) {
+      node_ = node_->get_child(node_->get_count());
+    }
+    position_ = node_->get_count() - 1;
+  } else if (position_ > 0) {
+    --position_;
+  } else {
+    btree_node *node = node_;
+    while (node->get_position() == 0 && node->get_parent() != nullptr) {
+      node = node->get_parent();
+    }
+    if (node->get_parent() != nullptr) {
+      position_ = node->get_position() - 1;
+      node_ = node->get_parent();
+    }
+  }
+
+  return *this;
+}
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::iterator &
+btree_node<V, K, T>::iterator::operator++() {
+  if (!node_->is_leaf()) {
+    node_ = node_->get_child(position_ + 1);
+    while (!node_->is_leaf()) {
+      node_ = node_->get_child(0);
+    }
+    position_ = 0;
+    return *this;
+  }
+
+  ++position_;
+  if (position_ < node_->get_count()) {
+    return *this;
+  }
+  btree_node *node = node_;
+  size_type position = position_;
+  while (position == node->get_count() && node->get_parent() != nullptr) {
+    position = node->get_position();
+    node = node->get_parent();
+  }
+  // climbing out of the root means the last value was passed: stay one past
+  // it in the rightmost leaf, which is the end iterator
+  if (position < node->get_count()) {
+    node_ = node;
+    position_ = position;
+  }
+
+  return *this;
+}
+
+template <class V, class K, class T>
+bool btree_node<V, K, T>::iterator::operator==(
+    const iterator &other) const noexcept {
+  return node_ == other.node_ && position_ == other.position_;
+}
+
+template <class V, class K, class T>
+bool btree_node<V, K, T>::iterator::operator!=(
+    const iterator &other) const noexcept {
+  return !(*this == other);
+}
+
+template <class V, class K, class T>
+btree_node<V, K, T>::iterator::BTreeIterator(btree_node *node,
+                                             size_type position) noexcept
+    : node_(node), position_(position) {}
+
+template <class V, class K, class T>
+btree_node<V, K, T> *btree_node<V, K, T>::iterator::get_node() const noexcept {
+  return node_;
+}
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::size_type
+btree_node<V, K, T>::iterator::get_position() const noexcept {
+  return position_;
+}
+
+template <class V, class K, class T>
+btree_node<V, K, T>::btree_node(bool leaf) noexcept : leaf_(leaf) {}
+
+template <class V, class K, class T>
+btree_node<V, K, T>::~btree_node() noexcept {
+  std::destroy_n(values(), count_);
+}
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::value_type *
+btree_node<V, K, T>::values() noexcept {
+  return std::launder(reinterpret_cast<value_type *>(storage_));
+}
+
+template <class V, class K, class T>
+const typename btree_node<V, K, T>::value_type *btree_node<V, K, T>::values()
+    const noexcept {
+  return std::launder(reinterpret_cast<const value_type *>(storage_));
+}
+
+template <class V, class K, class T>
+btree_node<V, K, T> *btree_node<V, K, T>::create(bool leaf) {
+  if (leaf) {
+    return new btree_node(true);
+  }
+  return new inner_node();
+}
+
+template <class V, class K, class T>
+void btree_node<V, K, T>::destroy(btree_node *node) noexcept {
+  if (node->is_leaf()) {
+    delete node;
+  } else {
+    delete static_cast<inner_node *>(node);
+  }
+}
+
+template <class V, class K, class T>
+bool btree_node<V, K, T>::is_leaf() const noexcept {
+  return leaf_;
+}
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::size_type btree_node<V, K, T>::get_count()
+    const noexcept {
+  return count_;
+}
+
+template <class V, class K, class T>
+btree_node<V, K, T> *btree_node<V, K, T>::get_parent() const noexcept {
+  return parent_;
+}
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::size_type btree_node<V, K, T>::get_position()
+    const noexcept {
+  return position_;
+}
+
+template <class V, class K, class T>
+typename btree_node<V, K, T>::value_type &btree_node<V, K, T>::get_value(
+    size_type index) noexcept {
+  return values()[index];
+}
+
+template <class V, class K, class T>
+const typename btree_node<V, K, T>::key_type &btree_node<V, K, T>::get_key(
+    size_type index) const noexcept {
+  return values()[index].key();
+}
+
+template <class V, class K, class T>
+btree_node<V, K, T> *btree_node<V, K, T>::get_child(
+    size_type index) const noexcept {
+  return static_cast<const inner_node *>(this)->children_[index];
+}
+
+template <class V, class K, class T>
+void btree_node<V, K, T>::truncate(size_type count) noexcept {
+  std::destroy(values() + count, values() + count_);
+  count_ = static_cast<unsigned short>(count);
+}
+
+template <class V, class K, class T>
+void btree_node<V, K, T>::set_child(size_type index,
+                                    btree_node *child) noexcept {
+  static_cast<inner_node *>(this)->children_[index] = child;
+  child->parent_ = this;
+  child->position_ = static_cast<unsigned short>(index);
+}
+
+template <class V, class K, class T>
+void btree_node<V, K, T>::detach() noexcept {
+  parent_ = nullptr;
+  position_ = 0;
+}
+
+template <class V, class K, class T>
+void btree_node<V, K, T>::insert_value(size_type index, value_type value,
+                                       btree_node *child) {
+  value_type *slots = values();
+  if (index == count_) {
+    new (slots + count_) value_type(std::move(value));
+  } else {
+    new (slots + count_) value_type(std::move(slots[count_ - 1]));
+    std::move_backward(slots + index, slots + count_ - 1, slots + count_);
+    slots[index] = std::move(value);
+  }
+  if (!leaf_) {
+    for (size_type i = count_ + 1U; i > index + 1; --i) {
+      set_child(i, get_child(i - 1));
+    }
+    set_child(index + 1, child);
+  }
+  ++count_;
+}
+
+template <class V, class K, class T>
+void btree_node<V, K, T>::erase_value(size_type index) {
+  value_type *slots = values();
+  std::move(slots + index + 1, slots + count_, slots + index);
+  std::destroy_at(slots + count_ - 1);
+  if (!leaf_) {
+    for (size_type i = index + 1; i < count_; ++i) {
+      set_child(i, get_child(i + 1));
+    }
+  }
+  --count_;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_BTREE_NODE_H_
@@ -0,0 +1,306 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_BTREE_SET_H_
+#define SRC_SOURCE_BTREE_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "btree.h"
+#include "container.h"
+
+namespace s21 {
+
+// set interface over a B-tree: denser and faster to search than set for
+// large key sets. Inserts and erases invalidate all iterators, there are
+// no node handles
+template <class V, class Compare = std::less<V>>
+class btree_set : public container<V> {
+ private:
+  struct KeyTreeNode;
+  using tree_type = btree<KeyTreeNode, V, V, Compare>;
+
+ public:
+  using value_type = V;
+  using key_type = V;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  btree_set() noexcept = default;
+  btree_set(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  btree_set(InputIt first, InputIt last);
+  btree_set(const btree_set &other);
+  btree_set(btree_set &&other) noexcept;
+  btree_set &operator=(const btree_set &other);
+  btree_set &operator=(btree_set &&other) noexcept;
+
+  ~btree_set() noexcept = default;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  [[nodiscard]] size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  iterator insert(iterator hint, const value_type &value);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+  void erase(iterator pos);
+  void swap(btree_set &other) noexcept;
+  void merge(btree_set &other);
+
+  iterator find(const key_type &key) const noexcept;
+  [[nodiscard]] bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, enabled for transparent comparators only
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] bool contains(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] size_type count(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  struct KeyTreeNode {
+   public:
+    [[nodiscard]] const value_type &key() const noexcept;
+    KeyTreeNode() noexcept = default;
+    KeyTreeNode(value_type value) noexcept;
+    value_type value_ = value_type();
+  };
+
+  tree_type tree_ = tree_type();
+};
+
+template <class V, class Compare>
+btree_set<V, Compare>::btree_set(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &elem : items) {
+    insert(end(), elem);
+  }
+}
+
+template <class V, class Compare>
+template <class InputIt>
+btree_set<V, Compare>::btree_set(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(end(), *first);
+  }
+}
+
+template <class V, class Compare>
+btree_set<V, Compare>::btree_set(const btree_set &other) {
+  *this = other;
+}
+
+template <class V, class Compare>
+btree_set<V, Compare>::btree_set(btree_set &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class V, class Compare>
+btree_set<V, Compare> &btree_set<V, Compare>::operator=(
+    const btree_set &other) {
+  tree_ = other.tree_;
+  return *this;
+}
+
+template <class V, class Compare>
+btree_set<V, Compare> &btree_set<V, Compare>::operator=(
+    btree_set &&other) noexcept {
+  tree_ = std::move(other.tree_);
+  return *this;
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::begin()
+    const noexcept {
+  return tree_.begin();
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::end()
+    const noexcept {
+  return tree_.end();
+}
+
+template <class V, class Compare>
+bool btree_set<V, Compare>::empty() const noexcept {
+  return tree_.empty();
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::size_type btree_set<V, Compare>::size()
+    const noexcept {
+  return tree_.size();
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::size_type btree_set<V, Compare>::max_size()
+    const noexcept {
+  return tree_.max_size();
+}
+
+template <class V, class Compare>
+void btree_set<V, Compare>::clear() noexcept {
+  tree_.clear();
+}
+
+template <class V, class Compare>
+std::pair<typename btree_set<V, Compare>::iterator, bool>
+btree_set<V, Compare>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = tree_.try_emplace(value, value);
+  if (!result.second) {
+    result.first = tree_.end();
+  }
+  return result;
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::insert(
+    iterator hint, const value_type &value) {
+  return tree_.try_emplace_hint(hint, value, value).first;
+}
+
+template <class V, class Compare>
+template <class... Args>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::emplace_hint(
+    iterator hint, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return tree_.try_emplace_hint(hint, value, std::move(value)).first;
+}
+
+template <class V, class Compare>
+void btree_set<V, Compare>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <class V, class Compare>
+void btree_set<V, Compare>::swap(btree_set &other) noexcept {
+  tree_.swap(other.tree_);
+}
+
+// Values absent here are moved from other, the rest stay there
+template <class V, class Compare>
+void btree_set<V, Compare>::merge(btree_set &other) {
+  tree_.merge_unique(other.tree_);
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::find(
+    const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class V, class Compare>
+bool btree_set<V, Compare>::contains(const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::size_type btree_set<V, Compare>::count(
+    const key_type &key) const noexcept {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::lower_bound(
+    const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::upper_bound(
+    const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare>
+std::pair<typename btree_set<V, Compare>::iterator,
+          typename btree_set<V, Compare>::iterator>
+btree_set<V, Compare>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::find(
+    const Key &key) const {
+  return tree_.find(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+bool btree_set<V, Compare>::contains(const Key &key) const {
+  return tree_.contains(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename btree_set<V, Compare>::size_type btree_set<V, Compare>::count(
+    const Key &key) const {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::lower_bound(
+    const Key &key) const {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename btree_set<V, Compare>::iterator btree_set<V, Compare>::upper_bound(
+    const Key &key) const {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+std::pair<typename btree_set<V, Compare>::iterator,
+          typename btree_set<V, Compare>::iterator>
+btree_set<V, Compare>::equal_range(const Key &key) const {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare>
+typename btree_set<V, Compare>::key_compare btree_set<V, Compare>::key_comp()
+    const {
+  return tree_.key_comp();
+}
+
+template <class V, class Compare>
+const typename btree_set<V, Compare>::value_type &
+btree_set<V, Compare>::KeyTreeNode::key() const noexcept {
+  return value_;
+}
+
+template <class V, class Compare>
+btree_set<V, Compare>::KeyTreeNode::KeyTreeNode(value_type value) noexcept
+    : value_(std::move(value)) {}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_BTREE_SET_H_
@@ -0,0 +1,200 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_CONCURRENT_MAP_H_
+#define SRC_SOURCE_CONCURRENT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "hash_mix.h"
+#include "map.h"
+
+namespace s21 {
+
+// Keys are spread by Hash over Shards maps, each behind its own
+// reader-writer lock: readers of one shard run together, writers only
+// block the shard of their key. No iterators or references leave a lock,
+// lookups return copies and for_each visits under the shard lock.
+// size() and for_each see each shard at a different moment
+template <class K, class T, size_t Shards = 16, class Hash = std::hash<K>,
+          class Compare = std::less<K>>
+class concurrent_map {
+  static_assert(Shards > 0, "concurrent_map needs at least one shard");
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<K, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using hasher = Hash;
+  using key_compare = Compare;
+  using size_type = size_t;
+
+  concurrent_map() = default;
+  concurrent_map(std::initializer_list<value_type> const &items);
+  // Shards hold mutexes, the map stays where it was built
+  concurrent_map(const concurrent_map &other) = delete;
+  concurrent_map &operator=(const concurrent_map &other) = delete;
+
+  ~concurrent_map() noexcept = default;
+
+  [[nodiscard]] bool empty() const;
+  [[nodiscard]] size_type size() const;
+
+  void clear();
+  // Both return true if the key was absent
+  bool insert(const key_type &key, const mapped_type &obj);
+  bool insert_or_assign(const key_type &key, const mapped_type &obj);
+  // Returns true if the key was present
+  bool erase(const key_type &key);
+
+  std::optional<mapped_type> find(const key_type &key) const;
+  [[nodiscard]] bool contains(const key_type &key) const;
+
+  // func(const value_type &) under a shared lock of each shard in turn,
+  // func must not call back into the map
+  template <class F>
+  void for_each(F func) const;
+  // func(value_type &) under an exclusive lock, the key must stay as is
+  template <class F>
+  void for_each(F func);
+
+ private:
+  // One cache line per shard, so writers of neighbours do not contend
+  struct alignas(64) shard {
+    mutable std::shared_mutex mutex_ = std::shared_mutex();
+    map<K, T, Compare> map_ = map<K, T, Compare>();
+  };
+
+  shard shards_[Shards];
+  Hash hash_ = Hash();
+
+  shard &shard_of(const key_type &key);
+  const shard &shard_of(const key_type &key) const;
+};
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+concurrent_map<K, T, Shards, Hash, Compare>::concurrent_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &elem : items) {
+    insert(elem.first, elem.second);
+  }
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+bool concurrent_map<K, T, Shards, Hash, Compare>::empty() const {
+  return size() == 0;
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+typename concurrent_map<K, T, Shards, Hash, Compare>::size_type
+concurrent_map<K, T, Shards, Hash, Compare>::size() const {
+  size_type total = 0;
+  for (const shard &part : shards_) {
+    std::shared_lock<std::shared_mutex> lock(part.mutex_);
+    total += part.map_.size();
+  }
+  return total;
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+void concurrent_map<K, T, Shards, Hash, Compare>::clear() {
+  for (shard &part : shards_) {
+    std::unique_lock<std::shared_mutex> lock(part.mutex_);
+    part.map_.clear();
+  }
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+bool concurrent_map<K, T, Shards, Hash, Compare>::insert(
+    const key_type &key, const mapped_type &obj) {
+  shard &part = shard_of(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  return part.map_.insert(key, obj).second;
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+bool concurrent_map<K, T, Shards, Hash, Compare>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  shard &part = shard_of(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  return part.map_.insert_or_assign(key, obj).second;
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+bool concurrent_map<K, T, Shards, Hash, Compare>::erase(const key_type &key) {
+  shard &part = shard_of(key);
+  std::unique_lock<std::shared_mutex> lock(part.mutex_);
+  auto found = part.map_.find(key);
+  if (found == part.map_.end()) {
+    return false;
+  }
+  part.map_.erase(found);
+  return true;
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+std::optional<typename concurrent_map<K, T, Shards, Hash, Compare>::mapped_type>
+concurrent_map<K, T, Shards, Hash, Compare>::find(const key_type &key) const {
+  const shard &part = shard_of(key);
+  std::shared_lock<std::shared_mutex> lock(part.mutex_);
+  auto found = part.map_.find(key);
+  if (found == part.map_.end()) {
+    return std::nullopt;
+  }
+  return (*found).second;
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+bool concurrent_map<K, T, Shards, Hash, Compare>::contains(
+    const key_type &key) const {
+  const shard &part = shard_of(key);
+  std::shared_lock<std::shared_mutex> lock(part.mutex_);
+  return part.map_.contains(key);
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+template <class F>
+void concurrent_map<K, T, Shards, Hash, Compare>::for_each(F func) const {
+  for (const shard &part : shards_) {
+    std::shared_lock<std::shared_mutex> lock(part.mutex_);
+    for (auto it = part.map_.begin(); it != part.map_.end(); ++it) {
+      func(static_cast<const value_type &>(*it));
+    }
+  }
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+template <class F>
+void concurrent_map<K, T, Shards, Hash, Compare>::for_each(F func) {
+  for (shard &part : shards_) {
+    std::unique_lock<std::shared_mutex> lock(part.mutex_);
+    for (auto it = part.map_.begin(); it != part.map_.end(); ++it) {
+      func(*it);
+    }
+  }
+}
+
+// Mixed as in hash_table, otherwise keys sharing a stride would share a
+// shard
+template <class K, class T, size_t Shards, class Hash, class Compare>
+typename concurrent_map<K, T, Shards, Hash, Compare>::shard &
+concurrent_map<K, T, Shards, Hash, Compare>::shard_of(const key_type &key) {
+  return const_cast<shard &>(std::as_const(*this).shard_of(key));
+}
+
+template <class K, class T, size_t Shards, class Hash, class Compare>
+const typename concurrent_map<K, T, Shards, Hash, Compare>::shard &
+concurrent_map<K, T, Shards, Hash, Compare>::shard_of(
+    const key_type &key) const {
+  return shards_[mix_hash(hash_(key)) % Shards];
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_CONCURRENT_MAP_H_
@@ -7,6 +7,11 @@
 
 namespace s21 {
 
+// Marks a range already sorted by the container Compare and free of
+// duplicate keys, e.g. set(kSorted, first, last)
+struct sorted_tag {};
+constexpr sorted_tag kSorted{};
+
 template <class T>
 class container {
  public:
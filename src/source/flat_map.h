@@ -0,0 +1,403 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_FLAT_MAP_H_
+#define SRC_SOURCE_FLAT_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "flat_tree.h"
+#include "container.h"
+
+namespace s21 {
+
+// map interface over a sorted s21::vector of pairs: no per-element nodes,
+// lookups are binary searches over one block. Meant for tables built once
+// and read often: a single insert or erase is O(n) and invalidates all
+// iterators, there are no node handles
+template <class K, class T, class Compare = std::less<K>>
+class flat_map : public container<T> {
+ private:
+  struct KeyOfValue;
+  using tree_type = flat_tree<std::pair<K, T>, K, KeyOfValue, Compare>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<K, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using size_type = size_t;
+
+  flat_map() noexcept = default;
+  flat_map(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  flat_map(InputIt first, InputIt last);
+  template <class InputIt>
+  flat_map(sorted_tag tag, InputIt first, InputIt last);
+  flat_map(const flat_map &m);
+  flat_map(flat_map &&m) noexcept;
+
+  ~flat_map() noexcept = default;
+
+  flat_map &operator=(const flat_map &m);
+  flat_map &operator=(flat_map &&m) noexcept;
+
+  mapped_type &at(const key_type &key);
+  mapped_type &operator[](const key_type &key);
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  iterator insert(iterator hint, const value_type &value);
+  // Sorts the range and merges it in a single pass. Only iterators take
+  // this overload, insert(key, obj) stays for anything else
+  template <class InputIt, class = decltype(*std::declval<InputIt &>())>
+  void insert(InputIt first, InputIt last);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+  void erase(iterator pos);
+  void swap(flat_map &other);
+  void merge(flat_map &other);
+  template <class InputIt>
+  void bulk_load(InputIt first, InputIt last, sorted_tag tag);
+  void reserve(size_type count);
+  void shrink_to_fit();
+
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  // Element at position k in order, end() if k >= size(), and the number
+  // of keys less than key
+  iterator nth(size_type k) const noexcept;
+  [[nodiscard]] size_type rank(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, enabled for transparent comparators only
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  bool contains(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] size_type count(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  struct KeyOfValue {
+    static const key_type &key(const value_type &value) noexcept;
+  };
+
+  tree_type tree_ = tree_type();
+};
+
+template <class K, class T, class Compare>
+flat_map<K, T, Compare>::flat_map(
+    const std::initializer_list<value_type> &items) {
+  tree_.insert_range(items.begin(), items.end());
+}
+
+template <class K, class T, class Compare>
+template <class InputIt>
+flat_map<K, T, Compare>::flat_map(InputIt first, InputIt last) {
+  tree_.insert_range(first, last);
+}
+
+template <class K, class T, class Compare>
+template <class InputIt>
+flat_map<K, T, Compare>::flat_map(sorted_tag tag, InputIt first,
+                                  InputIt last) {
+  bulk_load(first, last, tag);
+}
+
+template <class K, class T, class Compare>
+flat_map<K, T, Compare>::flat_map(const flat_map &m) {
+  *this = m;
+}
+
+template <class K, class T, class Compare>
+flat_map<K, T, Compare>::flat_map(flat_map &&m) noexcept {
+  *this = std::move(m);
+}
+
+template <class K, class T, class Compare>
+flat_map<K, T, Compare> &flat_map<K, T, Compare>::operator=(
+    const flat_map &m) {
+  tree_ = m.tree_;
+  return *this;
+}
+
+template <class K, class T, class Compare>
+flat_map<K, T, Compare> &flat_map<K, T, Compare>::operator=(
+    flat_map &&m) noexcept {
+  tree_ = std::move(m.tree_);
+  return *this;
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::mapped_type &flat_map<K, T, Compare>::at(
+    const key_type &key) {
+  iterator found = tree_.find(key);
+  if (found == end()) {
+    throw std::out_of_range(
+        "Container does not have an element with the specified key");
+  }
+  return (*found).second;
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::mapped_type &
+flat_map<K, T, Compare>::operator[](const key_type &key) {
+  // the mapped value is constructed only if key is absent
+  std::pair<iterator, bool> result = tree_.try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::tuple<>());
+  return (*result.first).second;
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator flat_map<K, T, Compare>::begin()
+    const noexcept {
+  return tree_.begin();
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator flat_map<K, T, Compare>::end()
+    const noexcept {
+  return tree_.end();
+}
+
+template <class K, class T, class Compare>
+bool flat_map<K, T, Compare>::empty() const noexcept {
+  return tree_.empty();
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::size_type flat_map<K, T, Compare>::size()
+    const noexcept {
+  return tree_.size();
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::size_type
+flat_map<K, T, Compare>::max_size() const noexcept {
+  return tree_.max_size();
+}
+
+template <class K, class T, class Compare>
+void flat_map<K, T, Compare>::clear() noexcept {
+  tree_.clear();
+}
+
+template <class K, class T, class Compare>
+std::pair<typename flat_map<K, T, Compare>::iterator, bool>
+flat_map<K, T, Compare>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = tree_.try_emplace(value.first, value);
+  if (!result.second) {
+    result.first = tree_.end();
+  }
+  return result;
+}
+
+template <class K, class T, class Compare>
+std::pair<typename flat_map<K, T, Compare>::iterator, bool>
+flat_map<K, T, Compare>::insert(const key_type &key, const mapped_type &obj) {
+  std::pair<iterator, bool> result = tree_.try_emplace(key, key, obj);
+  if (!result.second) {
+    result.first = tree_.end();
+  }
+  return result;
+}
+
+template <class K, class T, class Compare>
+std::pair<typename flat_map<K, T, Compare>::iterator, bool>
+flat_map<K, T, Compare>::insert_or_assign(const key_type &key,
+                                           const mapped_type &obj) {
+  std::pair<iterator, bool> result = tree_.try_emplace(key, key, obj);
+  if (!result.second) {
+    (*result.first).second = obj;
+  }
+  return result;
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator flat_map<K, T, Compare>::insert(
+    iterator hint, const value_type &value) {
+  return tree_.try_emplace_hint(hint, value.first, value).first;
+}
+
+template <class K, class T, class Compare>
+template <class... Args>
+typename flat_map<K, T, Compare>::iterator
+flat_map<K, T, Compare>::emplace_hint(iterator hint, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return tree_.try_emplace_hint(hint, value.first, std::move(value)).first;
+}
+
+template <class K, class T, class Compare>
+template <class InputIt, class>
+void flat_map<K, T, Compare>::insert(InputIt first, InputIt last) {
+  tree_.insert_range(first, last);
+}
+
+template <class K, class T, class Compare>
+void flat_map<K, T, Compare>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <class K, class T, class Compare>
+void flat_map<K, T, Compare>::swap(flat_map &other) {
+  tree_.swap(other.tree_);
+}
+
+// Values with keys absent here are moved from other, the rest stay there
+template <class K, class T, class Compare>
+void flat_map<K, T, Compare>::merge(flat_map &other) {
+  tree_.merge_unique(other.tree_);
+}
+
+template <class K, class T, class Compare>
+template <class InputIt>
+void flat_map<K, T, Compare>::bulk_load(InputIt first, InputIt last,
+                                        sorted_tag tag) {
+  tree_.bulk_load(first, last, tag);
+}
+
+template <class K, class T, class Compare>
+void flat_map<K, T, Compare>::reserve(size_type count) {
+  tree_.reserve(count);
+}
+
+template <class K, class T, class Compare>
+void flat_map<K, T, Compare>::shrink_to_fit() {
+  tree_.shrink_to_fit();
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator flat_map<K, T, Compare>::find(
+    const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare>
+bool flat_map<K, T, Compare>::contains(const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::size_type flat_map<K, T, Compare>::count(
+    const key_type &key) const noexcept {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator
+flat_map<K, T, Compare>::lower_bound(const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator
+flat_map<K, T, Compare>::upper_bound(const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare>
+std::pair<typename flat_map<K, T, Compare>::iterator,
+          typename flat_map<K, T, Compare>::iterator>
+flat_map<K, T, Compare>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::iterator flat_map<K, T, Compare>::nth(
+    size_type k) const noexcept {
+  return tree_.nth(k);
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::size_type flat_map<K, T, Compare>::rank(
+    const key_type &key) const noexcept {
+  return tree_.rank(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename flat_map<K, T, Compare>::iterator flat_map<K, T, Compare>::find(
+    const Key &key) const {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+bool flat_map<K, T, Compare>::contains(const Key &key) const {
+  return tree_.contains(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename flat_map<K, T, Compare>::size_type flat_map<K, T, Compare>::count(
+    const Key &key) const {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename flat_map<K, T, Compare>::iterator
+flat_map<K, T, Compare>::lower_bound(const Key &key) const {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+typename flat_map<K, T, Compare>::iterator
+flat_map<K, T, Compare>::upper_bound(const Key &key) const {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare>
+template <class Key, class C, class>
+std::pair<typename flat_map<K, T, Compare>::iterator,
+          typename flat_map<K, T, Compare>::iterator>
+flat_map<K, T, Compare>::equal_range(const Key &key) const {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare>
+typename flat_map<K, T, Compare>::key_compare
+flat_map<K, T, Compare>::key_comp() const {
+  return tree_.key_comp();
+}
+
+template <class K, class T, class Compare>
+const typename flat_map<K, T, Compare>::key_type &
+flat_map<K, T, Compare>::KeyOfValue::key(const value_type &value) noexcept {
+  return value.first;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_FLAT_MAP_H_
@@ -0,0 +1,348 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_FLAT_SET_H_
+#define SRC_SOURCE_FLAT_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "flat_tree.h"
+#include "container.h"
+
+namespace s21 {
+
+// set interface over a sorted s21::vector: no per-element nodes, lookups
+// are binary searches over one block. Meant for sets built once and read
+// often: a single insert or erase is O(n) and invalidates all iterators,
+// there are no node handles
+template <class V, class Compare = std::less<V>>
+class flat_set : public container<V> {
+ private:
+  struct KeyOfValue;
+  using tree_type = flat_tree<V, V, KeyOfValue, Compare>;
+
+ public:
+  using value_type = V;
+  using key_type = V;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  flat_set() noexcept = default;
+  flat_set(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  flat_set(InputIt first, InputIt last);
+  template <class InputIt>
+  flat_set(sorted_tag tag, InputIt first, InputIt last);
+  flat_set(const flat_set &other);
+  flat_set(flat_set &&other) noexcept;
+  flat_set &operator=(const flat_set &other);
+  flat_set &operator=(flat_set &&other) noexcept;
+
+  ~flat_set() noexcept = default;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  [[nodiscard]] size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  iterator insert(iterator hint, const value_type &value);
+  // Sorts the range and merges it in a single pass
+  template <class InputIt>
+  void insert(InputIt first, InputIt last);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+  void erase(iterator pos);
+  void swap(flat_set &other) noexcept;
+  void merge(flat_set &other);
+  template <class InputIt>
+  void bulk_load(InputIt first, InputIt last, sorted_tag tag);
+  void reserve(size_type count);
+  void shrink_to_fit();
+
+  iterator find(const key_type &key) const noexcept;
+  [[nodiscard]] bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  // Element at position k in order, end() if k >= size(), and the number
+  // of keys less than key
+  iterator nth(size_type k) const noexcept;
+  [[nodiscard]] size_type rank(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, enabled for transparent comparators only
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] bool contains(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] size_type count(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  struct KeyOfValue {
+    static const key_type &key(const value_type &value) noexcept;
+  };
+
+  tree_type tree_ = tree_type();
+};
+
+template <class V, class Compare>
+flat_set<V, Compare>::flat_set(std::initializer_list<value_type> const &items) {
+  tree_.insert_range(items.begin(), items.end());
+}
+
+template <class V, class Compare>
+template <class InputIt>
+flat_set<V, Compare>::flat_set(InputIt first, InputIt last) {
+  tree_.insert_range(first, last);
+}
+
+template <class V, class Compare>
+template <class InputIt>
+flat_set<V, Compare>::flat_set(sorted_tag tag, InputIt first, InputIt last) {
+  bulk_load(first, last, tag);
+}
+
+template <class V, class Compare>
+flat_set<V, Compare>::flat_set(const flat_set &other) {
+  *this = other;
+}
+
+template <class V, class Compare>
+flat_set<V, Compare>::flat_set(flat_set &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class V, class Compare>
+flat_set<V, Compare> &flat_set<V, Compare>::operator=(
+    const flat_set &other) {
+  tree_ = other.tree_;
+  return *this;
+}
+
+template <class V, class Compare>
+flat_set<V, Compare> &flat_set<V, Compare>::operator=(
+    flat_set &&other) noexcept {
+  tree_ = std::move(other.tree_);
+  return *this;
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::begin()
+    const noexcept {
+  return tree_.begin();
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::end()
+    const noexcept {
+  return tree_.end();
+}
+
+template <class V, class Compare>
+bool flat_set<V, Compare>::empty() const noexcept {
+  return tree_.empty();
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::size_type flat_set<V, Compare>::size()
+    const noexcept {
+  return tree_.size();
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::size_type flat_set<V, Compare>::max_size()
+    const noexcept {
+  return tree_.max_size();
+}
+
+template <class V, class Compare>
+void flat_set<V, Compare>::clear() noexcept {
+  tree_.clear();
+}
+
+template <class V, class Compare>
+std::pair<typename flat_set<V, Compare>::iterator, bool>
+flat_set<V, Compare>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = tree_.try_emplace(value, value);
+  if (!result.second) {
+    result.first = tree_.end();
+  }
+  return result;
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::insert(
+    iterator hint, const value_type &value) {
+  return tree_.try_emplace_hint(hint, value, value).first;
+}
+
+template <class V, class Compare>
+template <class... Args>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::emplace_hint(
+    iterator hint, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return tree_.try_emplace_hint(hint, value, std::move(value)).first;
+}
+
+template <class V, class Compare>
+template <class InputIt>
+void flat_set<V, Compare>::insert(InputIt first, InputIt last) {
+  tree_.insert_range(first, last);
+}
+
+template <class V, class Compare>
+void flat_set<V, Compare>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <class V, class Compare>
+void flat_set<V, Compare>::swap(flat_set &other) noexcept {
+  tree_.swap(other.tree_);
+}
+
+// Values absent here are moved from other, the rest stay there
+template <class V, class Compare>
+void flat_set<V, Compare>::merge(flat_set &other) {
+  tree_.merge_unique(other.tree_);
+}
+
+template <class V, class Compare>
+template <class InputIt>
+void flat_set<V, Compare>::bulk_load(InputIt first, InputIt last,
+                                     sorted_tag tag) {
+  tree_.bulk_load(first, last, tag);
+}
+
+template <class V, class Compare>
+void flat_set<V, Compare>::reserve(size_type count) {
+  tree_.reserve(count);
+}
+
+template <class V, class Compare>
+void flat_set<V, Compare>::shrink_to_fit() {
+  tree_.shrink_to_fit();
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::find(
+    const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class V, class Compare>
+bool flat_set<V, Compare>::contains(const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::size_type flat_set<V, Compare>::count(
+    const key_type &key) const noexcept {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::lower_bound(
+    const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::upper_bound(
+    const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare>
+std::pair<typename flat_set<V, Compare>::iterator,
+          typename flat_set<V, Compare>::iterator>
+flat_set<V, Compare>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::nth(
+    size_type k) const noexcept {
+  return tree_.nth(k);
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::size_type flat_set<V, Compare>::rank(
+    const key_type &key) const noexcept {
+  return tree_.rank(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::find(
+    const Key &key) const {
+  return tree_.find(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+bool flat_set<V, Compare>::contains(const Key &key) const {
+  return tree_.contains(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename flat_set<V, Compare>::size_type flat_set<V, Compare>::count(
+    const Key &key) const {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::lower_bound(
+    const Key &key) const {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+typename flat_set<V, Compare>::iterator flat_set<V, Compare>::upper_bound(
+    const Key &key) const {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare>
+template <class Key, class C, class>
+std::pair<typename flat_set<V, Compare>::iterator,
+          typename flat_set<V, Compare>::iterator>
+flat_set<V, Compare>::equal_range(const Key &key) const {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare>
+typename flat_set<V, Compare>::key_compare flat_set<V, Compare>::key_comp()
+    const {
+  return tree_.key_comp();
+}
+
+template <class V, class Compare>
+const typename flat_set<V, Compare>::key_type &
+flat_set<V, Compare>::KeyOfValue::key(const value_type &value) noexcept {
+  return value;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_FLAT_SET_H_
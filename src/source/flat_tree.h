@@ -0,0 +1,333 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_FLAT_TREE_H_
+#define SRC_SOURCE_FLAT_TREE_H_
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <utility>
+
+#include "container.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Unique keys kept sorted in one s21::vector: lookups are binary searches
+// over contiguous memory, single inserts and erases shift the tail.
+// T - stored value, K - key_type, KeyOf - class with
+// static const key_type &key(const T &), Compare - strict weak ordering of
+// keys. Any insert or erase invalidates iterators
+template <class T, class K, class KeyOf, class Compare = std::less<K>>
+class flat_tree {
+ public:
+  using value_type = T;
+  using key_type = K;
+  using iterator = typename vector<T>::iterator;
+  using const_iterator = typename vector<T>::const_iterator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  flat_tree() noexcept = default;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept;
+  [[nodiscard]] size_type size() const noexcept;
+  [[nodiscard]] size_type max_size() const noexcept;
+  [[nodiscard]] size_type capacity() const noexcept;
+  void reserve(size_type count);
+  void shrink_to_fit();
+
+  void clear() noexcept;
+  // The value is constructed from args only if key is absent, otherwise
+  // the iterator to the present element is returned
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  // hint is the element the new one goes before, a correct hint skips the
+  // binary search. key may refer into args: it is only compared before the
+  // value is emplaced into the vector
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace_hint(iterator hint,
+                                             const key_type &key,
+                                             Args &&...args);
+  // Sorts the range and merges it in one pass over both sequences: O(n + m)
+  // after sorting m new values instead of m shifts of the tail. Keys already
+  // present, or repeated in the range, keep their first value
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last);
+  // Replaces the content with the range as is, no comparisons
+  template <class InputIt>
+  void bulk_load(InputIt first, InputIt last, sorted_tag);
+  void erase(iterator pos);
+  void swap(flat_tree &other) noexcept;
+  // Moves the values with keys absent here out of other
+  void merge_unique(flat_tree &other);
+
+  // Lookup accepts any Key comparable with key_type by Compare
+  template <class Key>
+  iterator find(const Key &key) const;
+  template <class Key>
+  [[nodiscard]] bool contains(const Key &key) const;
+  template <class Key>
+  iterator lower_bound(const Key &key) const;
+  template <class Key>
+  iterator upper_bound(const Key &key) const;
+  template <class Key>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  // Positions are indices: both O(1) and O(log n)
+  iterator nth(size_type k) const;
+  template <class Key>
+  [[nodiscard]] size_type rank(const Key &key) const;
+
+  Compare key_comp() const;
+
+ private:
+  vector<value_type> values_ = vector<value_type>();
+  Compare compare_ = Compare();
+
+  // One pass over values_ and the sorted incoming, both moved from.
+  // Duplicates are dropped
+  void merge_sorted(vector<value_type> &&incoming);
+};
+
+template <class T, class K, class KeyOf, class Compare>
+typename flat_tree<T, K, KeyOf, Compare>::iterator
+flat_tree<T, K, KeyOf, Compare>::begin() const noexcept {
+  return values_.begin();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+typename flat_tree<T, K, KeyOf, Compare>::iterator
+flat_tree<T, K, KeyOf, Compare>::end() const noexcept {
+  return values_.end();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+bool flat_tree<T, K, KeyOf, Compare>::empty() const noexcept {
+  return values_.empty();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+typename flat_tree<T, K, KeyOf, Compare>::size_type
+flat_tree<T, K, KeyOf, Compare>::size() const noexcept {
+  return values_.size();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+typename flat_tree<T, K, KeyOf, Compare>::size_type
+flat_tree<T, K, KeyOf, Compare>::max_size() const noexcept {
+  return values_.max_size();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+typename flat_tree<T, K, KeyOf, Compare>::size_type
+flat_tree<T, K, KeyOf, Compare>::capacity() const noexcept {
+  return values_.capacity();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::reserve(size_type count) {
+  values_.reserve(count);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::shrink_to_fit() {
+  values_.shrink_to_fit();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::clear() noexcept {
+  values_.clear();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class... Args>
+std::pair<typename flat_tree<T, K, KeyOf, Compare>::iterator, bool>
+flat_tree<T, K, KeyOf, Compare>::try_emplace(const key_type &key,
+                                             Args &&...args) {
+  iterator pos = lower_bound(key);
+  if (pos != end() && !compare_(key, KeyOf::key(*pos))) {
+    return std::pair<iterator, bool>(pos, false);
+  }
+
+  return std::pair<iterator, bool>(
+      values_.emplace(pos, std::forward<Args>(args)...), true);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class... Args>
+std::pair<typename flat_tree<T, K, KeyOf, Compare>::iterator, bool>
+flat_tree<T, K, KeyOf, Compare>::try_emplace_hint(iterator hint,
+                                                  const key_type &key,
+                                                  Args &&...args) {
+  bool fits = (hint == end() || compare_(key, KeyOf::key(*hint))) &&
+              (hint == begin() || compare_(KeyOf::key(*(hint - 1)), key));
+  if (!fits) {
+    return try_emplace(key, std::forward<Args>(args)...);
+  }
+
+  return std::pair<iterator, bool>(
+      values_.emplace(hint, std::forward<Args>(args)...), true);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class InputIt>
+void flat_tree<T, K, KeyOf, Compare>::insert_range(InputIt first,
+                                                   InputIt last) {
+  vector<value_type> incoming;
+  for (; first != last; ++first) {
+    incoming.push_back(*first);
+  }
+  if (incoming.empty()) {
+    return;
+  }
+
+  std::stable_sort(incoming.begin(), incoming.end(),
+                   [this](const value_type &left, const value_type &right) {
+                     return compare_(KeyOf::key(left), KeyOf::key(right));
+                   });
+  merge_sorted(std::move(incoming));
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class InputIt>
+void flat_tree<T, K, KeyOf, Compare>::bulk_load(InputIt first, InputIt last,
+                                                sorted_tag) {
+  values_.clear();
+  for (; first != last; ++first) {
+    values_.push_back(*first);
+  }
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::erase(iterator pos) {
+  values_.erase(pos);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::swap(flat_tree &other) noexcept {
+  values_.swap(other.values_);
+  std::swap(compare_, other.compare_);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::merge_unique(flat_tree &other) {
+  if (this == &other) {
+    return;
+  }
+
+  vector<value_type> rest;
+  vector<value_type> moved;
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    if (contains(KeyOf::key(*it))) {
+      rest.push_back(std::move(*it));
+    } else {
+      moved.push_back(std::move(*it));
+    }
+  }
+  merge_sorted(std::move(moved));
+  other.values_ = std::move(rest);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class Key>
+typename flat_tree<T, K, KeyOf, Compare>::iterator
+flat_tree<T, K, KeyOf, Compare>::find(const Key &key) const {
+  iterator pos = lower_bound(key);
+  if (pos != end() && !compare_(key, KeyOf::key(*pos))) {
+    return pos;
+  }
+
+  return end();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class Key>
+bool flat_tree<T, K, KeyOf, Compare>::contains(const Key &key) const {
+  return find(key) != end();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class Key>
+typename flat_tree<T, K, KeyOf, Compare>::iterator
+flat_tree<T, K, KeyOf, Compare>::lower_bound(const Key &key) const {
+  return std::lower_bound(begin(), end(), key,
+                          [this](const value_type &value, const Key &probe) {
+                            return compare_(KeyOf::key(value), probe);
+                          });
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class Key>
+typename flat_tree<T, K, KeyOf, Compare>::iterator
+flat_tree<T, K, KeyOf, Compare>::upper_bound(const Key &key) const {
+  return std::upper_bound(begin(), end(), key,
+                          [this](const Key &probe, const value_type &value) {
+                            return compare_(probe, KeyOf::key(value));
+                          });
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class Key>
+std::pair<typename flat_tree<T, K, KeyOf, Compare>::iterator,
+          typename flat_tree<T, K, KeyOf, Compare>::iterator>
+flat_tree<T, K, KeyOf, Compare>::equal_range(const Key &key) const {
+  iterator first = lower_bound(key);
+  iterator last = first;
+  if (last != end() && !compare_(key, KeyOf::key(*last))) {
+    ++last;
+  }
+
+  return std::pair<iterator, iterator>(first, last);
+}
+
+template <class T, class K, class KeyOf, class Compare>
+typename flat_tree<T, K, KeyOf, Compare>::iterator
+flat_tree<T, K, KeyOf, Compare>::nth(size_type k) const {
+  return k < size() ? begin() + k : end();
+}
+
+template <class T, class K, class KeyOf, class Compare>
+template <class Key>
+typename flat_tree<T, K, KeyOf, Compare>::size_type
+flat_tree<T, K, KeyOf, Compare>::rank(const Key &key) const {
+  return size_type(lower_bound(key) - begin());
+}
+
+template <class T, class K, class KeyOf, class Compare>
+Compare flat_tree<T, K, KeyOf, Compare>::key_comp() const {
+  return compare_;
+}
+
+template <class T, class K, class KeyOf, class Compare>
+void flat_tree<T, K, KeyOf, Compare>::merge_sorted(
+    vector<value_type> &&incoming) {
+  vector<value_type> merged;
+  merged.reserve(values_.size() + incoming.size());
+
+  iterator present = values_.begin();
+  iterator added = incoming.begin();
+  while (present != values_.end() || added != incoming.end()) {
+    // on equal keys the present value goes first and the added one is
+    // dropped below
+    bool take_present =
+        added == incoming.end() ||
+        (present != values_.end() &&
+         !compare_(KeyOf::key(*added), KeyOf::key(*present)));
+    value_type &next = take_present ? *present++ : *added++;
+    if (merged.empty() ||
+        compare_(KeyOf::key(merged.back()), KeyOf::key(next))) {
+      merged.push_back(std::move(next));
+    }
+  }
+
+  values_ = std::move(merged);
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_FLAT_TREE_H_
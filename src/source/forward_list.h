@@ -38,12 +38,25 @@ class forward_list : public container<T> {
   const_reference front() const;
   const_reference back() const;
 
-  virtual void push_back(const_reference value);
-  virtual void push_front(const_reference value);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  // The value is constructed in the new node from args
+  template <class... Args>
+  void emplace_back(Args &&...args);
+  template <class... Args>
+  void emplace_front(Args &&...args);
   virtual void pop_back();
   virtual void pop_front();
 
-  virtual list_node<T> *allocate_node(value_type value) const;
+  // A node of the kind this list links, list nodes also point back
+  template <class... Args>
+  list_node<T> *allocate_node(Args &&...args) const;
+  [[nodiscard]] virtual bool is_doubly_linked() const noexcept;
+  // Put a new node at an end, list also sets the backward links
+  virtual void link_back(list_node<T> *new_node);
+  virtual void link_front(list_node<T> *new_node);
   void clear() noexcept;
 
   list_node<T> *head_ = nullptr;
@@ -135,7 +148,38 @@ typename forward_list<T>::const_reference forward_list<T>::back() const {
 
 template <class T>
 void forward_list<T>::push_back(const_reference value) {
-  list_node<T> *new_node = allocate_node(value);
+  emplace_back(value);
+}
+
+template <class T>
+void forward_list<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class T>
+void forward_list<T>::push_front(const_reference value) {
+  emplace_front(value);
+}
+
+template <class T>
+void forward_list<T>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+void forward_list<T>::emplace_back(Args &&...args) {
+  link_back(allocate_node(std::forward<Args>(args)...));
+}
+
+template <class T>
+template <class... Args>
+void forward_list<T>::emplace_front(Args &&...args) {
+  link_front(allocate_node(std::forward<Args>(args)...));
+}
+
+template <class T>
+void forward_list<T>::link_back(list_node<T> *new_node) {
   ++size_;
 
   if (head_ == nullptr) {
@@ -148,8 +192,7 @@ void forward_list<T>::push_back(const_reference value) {
 }
 
 template <class T>
-void forward_list<T>::push_front(const_reference value) {
-  list_node<T> *new_node = allocate_node(value);
+void forward_list<T>::link_front(list_node<T> *new_node) {
   ++size_;
 
   if (head_ == nullptr) {
@@ -189,11 +232,16 @@ void forward_list<T>::pop_front() {
 }
 
 template <class T>
-list_node<T> *forward_list<T>::allocate_node(value_type value) const {
+template <class... Args>
+list_node<T> *forward_list<T>::allocate_node(Args &&...args) const {
   list_node<T> *new_node = nullptr;
 
   try {
-    new_node = new unary_node<T>(value);
+    if (is_doubly_linked()) {
+      new_node = new binary_node<T>(std::in_place, std::forward<Args>(args)...);
+    } else {
+      new_node = new unary_node<T>(std::in_place, std::forward<Args>(args)...);
+    }
   } catch (std::bad_alloc &e) {
     std::throw_with_nested(e);
   }
@@ -201,6 +249,11 @@ list_node<T> *forward_list<T>::allocate_node(value_type value) const {
   return new_node;
 }
 
+template <class T>
+bool forward_list<T>::is_doubly_linked() const noexcept {
+  return false;
+}
+
 template <class T>
 void forward_list<T>::clear() noexcept {
   for (list_node<T> *temp = head_; temp != nullptr; temp = head_) {
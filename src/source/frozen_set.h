@@ -0,0 +1,154 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_FROZEN_SET_H_
+#define SRC_SOURCE_FROZEN_SET_H_
+
+#include <cstdlib>
+#include <functional>
+
+#include "container.h"
+#include "vector.h"
+
+namespace s21 {
+
+// Read-only set for tables built once and queried often. The keys are
+// kept in Eytzinger order: the root at index 1 and the children of k at
+// 2k and 2k + 1, all in one array. A lookup walks down without a branch
+// on the comparison, and the top of the path sits in a few cache lines.
+// The descendants kPrefetchLevels below are prefetched while the current
+// level is compared
+template <class V, class Compare = std::less<V>>
+class frozen_set : public container<V> {
+ public:
+  using value_type = V;
+  using key_type = V;
+  using key_compare = Compare;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  frozen_set() noexcept = default;
+  // The range must be sorted by Compare and free of duplicates, as a set.
+  // It is walked twice: to count and to copy
+  template <class ForwardIt>
+  frozen_set(sorted_tag tag, ForwardIt first, ForwardIt last);
+
+  ~frozen_set() noexcept = default;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  [[nodiscard]] size_type max_size() const noexcept;
+
+  [[nodiscard]] bool contains(const key_type &key) const;
+  [[nodiscard]] size_type count(const key_type &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  // The 2^kPrefetchLevels descendants of a node lie side by side, one
+  // cache line of them is fetched per step
+  static constexpr size_type kBlock = sizeof(V) <= 4    ? 16
+                                      : sizeof(V) <= 8  ? 8
+                                      : sizeof(V) <= 16 ? 4
+                                      : sizeof(V) <= 32 ? 2
+                                                        : 1;
+
+  vector<value_type> values_ = vector<value_type>();  // [0] unused
+  size_type size_ = 0;
+  Compare compare_ = Compare();
+
+  // In order walk of the implicit tree takes the sorted range in order
+  template <class ForwardIt>
+  void fill(ForwardIt &next, size_type index);
+  // Index of the first key not less than key, 0 if there is none
+  size_type lower_index(const key_type &key) const;
+};
+
+template <class V, class Compare>
+template <class ForwardIt>
+frozen_set<V, Compare>::frozen_set(sorted_tag, ForwardIt first,
+                                   ForwardIt last) {
+  for (ForwardIt it = first; it != last; ++it) {
+    ++size_;
+  }
+  values_ = vector<value_type>(size_ + 1);
+  fill(first, 1);
+}
+
+template <class V, class Compare>
+bool frozen_set<V, Compare>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class V, class Compare>
+typename frozen_set<V, Compare>::size_type frozen_set<V, Compare>::size()
+    const noexcept {
+  return size_;
+}
+
+template <class V, class Compare>
+typename frozen_set<V, Compare>::size_type frozen_set<V, Compare>::max_size()
+    const noexcept {
+  return values_.max_size() - 1;
+}
+
+template <class V, class Compare>
+bool frozen_set<V, Compare>::contains(const key_type &key) const {
+  size_type index = lower_index(key);
+  return index != 0 && !compare_(key, values_.data()[index]);
+}
+
+template <class V, class Compare>
+typename frozen_set<V, Compare>::size_type frozen_set<V, Compare>::count(
+    const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare>
+typename frozen_set<V, Compare>::key_compare frozen_set<V, Compare>::key_comp()
+    const {
+  return compare_;
+}
+
+template <class V, class Compare>
+template <class ForwardIt>
+void frozen_set<V, Compare>::fill(ForwardIt &next, size_type index) {
+  if (index > size_) {
+    return;
+  }
+  fill(next, index * 2);
+  values_.data()[index] = *next;
+  ++next;
+  fill(next, index * 2 + 1);
+}
+
+// Going right sets a one bit in index, going left a zero. Past the leaf,
+// the answer is the last node the walk went left at: drop the trailing
+// ones and the zero before them
+template <class V, class Compare>
+typename frozen_set<V, Compare>::size_type frozen_set<V, Compare>::lower_index(
+    const key_type &key) const {
+  const value_type *values = values_.data();
+  size_type index = 1;
+  while (index <= size_) {
+#if defined(__GNUC__) || defined(__clang__)
+    size_type ahead = index * kBlock;
+    __builtin_prefetch(values + (ahead <= size_ ? ahead : 0));
+#endif
+    index = index * 2 + size_type(compare_(values[index], key));
+  }
+
+#if defined(__GNUC__) || defined(__clang__)
+  unsigned long long path = index;
+  return index >> (__builtin_ctzll(~path) + 1);
+#else
+  while ((index & 1) != 0) {
+    index >>= 1;
+  }
+  return index >> 1;
+#endif
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_FROZEN_SET_H_
@@ -0,0 +1,20 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_HASH_MIX_H_
+#define SRC_SOURCE_HASH_MIX_H_
+
+#include <cstdlib>
+
+namespace s21 {
+
+// std::hash of an integer is the integer itself, so keys sharing a stride
+// share their low bits. The product spreads the hash over all bits and the
+// fold brings the high ones back down
+inline size_t mix_hash(size_t hash) noexcept {
+  hash *= static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+  return hash ^ (hash >> (sizeof(size_t) * 4));
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_HASH_MIX_H_
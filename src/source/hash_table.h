@@ -0,0 +1,607 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_HASH_TABLE_H_
+#define SRC_SOURCE_HASH_TABLE_H_
+
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "hash_mix.h"
+
+namespace s21 {
+
+// Control bytes of a hash_table, one per slot: a full slot holds the low 7
+// bits of the hash of its key, the others are negative
+enum hash_control : signed char {
+  kEmpty = -128,
+  kDeleted = -2,
+  kSentinel = -1,  // after the last slot, stops iteration
+};
+
+// kWidth control bytes compared at once, with SSE2 when the target has
+// it. Masks have bit i set for byte i
+class hash_group {
+ public:
+  static constexpr size_t kWidth = 16;
+
+  explicit hash_group(const signed char *control) noexcept;
+
+  uint32_t match(signed char h2) const noexcept;
+  uint32_t match_empty() const noexcept;
+  uint32_t match_empty_or_deleted() const noexcept;
+
+  // Index of the lowest set bit of a non-zero mask
+  static size_t lowest(uint32_t mask) noexcept;
+
+ private:
+#ifdef __SSE2__
+  __m128i control_;
+#else
+  const signed char *control_;
+#endif
+};
+
+// Swiss table: open addressing over groups of kWidth slots. The control
+// bytes of a group are probed together, so most lookups compare the full
+// key once and stop at the first group with an empty slot.
+// T - stored value, K - key_type, KeyOf - class with
+// static const key_type &key(const T &), Hash and Equal over keys.
+// Rehashing moves the values, so inserts invalidate iterators
+template <class T, class K, class KeyOf, class Hash = std::hash<K>,
+          class Equal = std::equal_to<K>>
+class hash_table {
+ public:
+  class HashIterator;
+  class HashConstIterator;
+
+  using value_type = T;
+  using key_type = K;
+  using iterator = HashIterator;
+  using const_iterator = HashConstIterator;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  class HashIterator {
+   public:
+    value_type &operator*();
+    iterator &operator++();
+    bool operator==(const iterator &other) const noexcept;
+    bool operator!=(const iterator &other) const noexcept;
+
+    HashIterator(signed char *control, value_type *slot) noexcept;
+    HashIterator() noexcept = default;
+
+   private:
+    friend class hash_table;
+
+    // both point at the sentinel, one past the last slot, for end
+    signed char *control_ = nullptr;
+    value_type *slot_ = nullptr;
+
+    void skip_free() noexcept;
+  };
+
+  class HashConstIterator : public HashIterator {
+   public:
+    using HashIterator::HashIterator;
+    const value_type &operator*();
+  };
+
+  hash_table() noexcept = default;
+  hash_table(const hash_table &other);
+  hash_table(hash_table &&other) noexcept;
+
+  ~hash_table() noexcept;
+
+  hash_table &operator=(const hash_table &other);
+  hash_table &operator=(hash_table &&other) noexcept;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept;
+  [[nodiscard]] size_type size() const noexcept;
+  [[nodiscard]] size_type max_size() const noexcept;
+  [[nodiscard]] size_type capacity() const noexcept;
+  // Room for count values without a rehash
+  void reserve(size_type count);
+
+  void clear() noexcept;
+  // The value is constructed from args only if key is absent, otherwise
+  // the iterator to the present element is returned
+  template <class... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  void erase(iterator pos);
+  void swap(hash_table &other) noexcept;
+  // Moves the values with keys absent here out of other
+  void merge_unique(hash_table &other);
+
+  iterator find(const key_type &key) const;
+  [[nodiscard]] bool contains(const key_type &key) const;
+
+ private:
+  // At most 7/8 of the slots are used before the table grows
+  static constexpr size_type kMaxLoadNum = 7;
+  static constexpr size_type kMaxLoadDen = 8;
+
+  signed char *control_ = nullptr;  // capacity_ + 1 bytes
+  value_type *slots_ = nullptr;
+  size_type capacity_ = 0;  // 0 or a power of two, a multiple of kWidth
+  size_type size_ = 0;
+  // Inserts into empty slots left before a rehash, a reused tombstone
+  // does not count
+  size_type growth_left_ = 0;
+  Hash hash_ = Hash();
+  Equal equal_ = Equal();
+
+  struct probe_result {
+    size_type index;
+    bool found;
+  };
+
+  size_type hash_of(const key_type &key) const;
+  static signed char h2(size_type hash) noexcept;
+  // Slot of key if present, otherwise the first free slot on its probe
+  // sequence. The table must not be empty
+  probe_result find_or_prepare(const key_type &key, size_type hash) const;
+  void set_control(size_type index, signed char control) noexcept;
+  void rehash(size_type new_capacity);
+  static size_type capacity_for(size_type count) noexcept;
+  void release() noexcept;
+};
+
+inline hash_group::hash_group(const signed char *control) noexcept
+#ifdef __SSE2__
+    : control_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(control))) {
+}
+#else
+    : control_(control) {
+}
+#endif
+
+#ifdef __SSE2__
+inline uint32_t hash_group::match(signed char h2) const noexcept {
+  return static_cast<uint32_t>(
+      _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), control_)));
+}
+
+inline uint32_t hash_group::match_empty() const noexcept {
+  return match(kEmpty);
+}
+
+// Empty and deleted are the control bytes below the sentinel
+inline uint32_t hash_group::match_empty_or_deleted() const noexcept {
+  return static_cast<uint32_t>(_mm_movemask_epi8(
+      _mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), control_)));
+}
+#else
+inline uint32_t hash_group::match(signed char h2) const noexcept {
+  uint32_t mask = 0;
+  for (size_t i = 0; i < kWidth; ++i) {
+    if (control_[i] == h2) {
+      mask |= uint32_t(1) << i;
+    }
+  }
+  return mask;
+}
+
+inline uint32_t hash_group::match_empty() const noexcept {
+  return match(kEmpty);
+}
+
+inline uint32_t hash_group::match_empty_or_deleted() const noexcept {
+  uint32_t mask = 0;
+  for (size_t i = 0; i < kWidth; ++i) {
+    if (control_[i] < kSentinel) {
+      mask |= uint32_t(1) << i;
+    }
+  }
+  return mask;
+}
+#endif
+
+inline size_t hash_group::lowest(uint32_t mask) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return static_cast<size_t>(__builtin_ctz(mask));
+#else
+  size_t index = 0;
+  while ((mask & 1) == 0) {
+    mask >>= 1;
+    ++index;
+  }
+  return index;
+#endif
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::value_type &
+hash_table<T, K, KeyOf, Hash, Equal>::iterator::operator*() {
+  return *slot_;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+const typename hash_table<T, K, KeyOf, Hash, Equal>::value_type &
+hash_table<T, K, KeyOf, Hash, Equal>::HashConstIterator::operator*() {
+  return HashIterator::operator*();
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::iterator &
+hash_table<T, K, KeyOf, Hash, Equal>::iterator::operator++() {
+  ++control_;
+  ++slot_;
+  skip_free();
+  return *this;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+bool hash_table<T, K, KeyOf, Hash, Equal>::iterator::operator==(
+    const iterator &other) const noexcept {
+  return control_ == other.control_;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+bool hash_table<T, K, KeyOf, Hash, Equal>::iterator::operator!=(
+    const iterator &other) const noexcept {
+  return !(*this == other);
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+hash_table<T, K, KeyOf, Hash, Equal>::iterator::HashIterator(
+    signed char *control, value_type *slot) noexcept
+    : control_(control), slot_(slot) {}
+
+// Full control bytes are non-negative, the sentinel stops the walk
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::iterator::skip_free() noexcept {
+  while (control_ != nullptr && *control_ < kSentinel) {
+    ++control_;
+    ++slot_;
+  }
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+hash_table<T, K, KeyOf, Hash, Equal>::hash_table(const hash_table &other) {
+  *this = other;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+hash_table<T, K, KeyOf, Hash, Equal>::hash_table(hash_table &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+hash_table<T, K, KeyOf, Hash, Equal>::~hash_table() noexcept {
+  release();
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+hash_table<T, K, KeyOf, Hash, Equal> &
+hash_table<T, K, KeyOf, Hash, Equal>::operator=(const hash_table &other) {
+  if (this == &other) {
+    return *this;
+  }
+
+  clear();
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+  reserve(other.size_);
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    try_emplace(KeyOf::key(*it), *it);
+  }
+
+  return *this;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+hash_table<T, K, KeyOf, Hash, Equal> &
+hash_table<T, K, KeyOf, Hash, Equal>::operator=(hash_table &&other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  release();
+  control_ = std::exchange(other.control_, nullptr);
+  slots_ = std::exchange(other.slots_, nullptr);
+  capacity_ = std::exchange(other.capacity_, 0);
+  size_ = std::exchange(other.size_, 0);
+  growth_left_ = std::exchange(other.growth_left_, 0);
+  hash_ = other.hash_;
+  equal_ = other.equal_;
+
+  return *this;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::iterator
+hash_table<T, K, KeyOf, Hash, Equal>::begin() const noexcept {
+  iterator first(control_, slots_);
+  first.skip_free();
+  return first;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::iterator
+hash_table<T, K, KeyOf, Hash, Equal>::end() const noexcept {
+  if (control_ == nullptr) {
+    return iterator();
+  }
+  return iterator(control_ + capacity_, slots_ + capacity_);
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+bool hash_table<T, K, KeyOf, Hash, Equal>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::size_type
+hash_table<T, K, KeyOf, Hash, Equal>::size() const noexcept {
+  return size_;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::size_type
+hash_table<T, K, KeyOf, Hash, Equal>::max_size() const noexcept {
+  return size_type(-1) / (sizeof(value_type) + 1) / kMaxLoadDen * kMaxLoadNum;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::size_type
+hash_table<T, K, KeyOf, Hash, Equal>::capacity() const noexcept {
+  return capacity_;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::reserve(size_type count) {
+  size_type needed = capacity_for(count);
+  if (needed > capacity_) {
+    rehash(needed);
+  }
+}
+
+// Keeps the slots, only the values and the tombstones go
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::clear() noexcept {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (control_[i] >= 0) {
+      slots_[i].~value_type();
+    }
+    control_[i] = kEmpty;
+  }
+  size_ = 0;
+  growth_left_ = capacity_ / kMaxLoadDen * kMaxLoadNum;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+template <class... Args>
+std::pair<typename hash_table<T, K, KeyOf, Hash, Equal>::iterator, bool>
+hash_table<T, K, KeyOf, Hash, Equal>::try_emplace(const key_type &key,
+                                                  Args &&...args) {
+  size_type hash = hash_of(key);
+  if (capacity_ == 0) {
+    rehash(capacity_for(1));
+  }
+
+  probe_result place = find_or_prepare(key, hash);
+  if (place.found) {
+    return std::pair<iterator, bool>(
+        iterator(control_ + place.index, slots_ + place.index), false);
+  }
+  if (growth_left_ == 0 && control_[place.index] == kEmpty) {
+    // mostly tombstones: dropping them at the same capacity is enough
+    bool crowded = size_ * 2 >= capacity_ / kMaxLoadDen * kMaxLoadNum;
+    rehash(crowded ? capacity_ * 2 : capacity_);
+    place = find_or_prepare(key, hash);
+  }
+
+  new (slots_ + place.index) value_type(std::forward<Args>(args)...);
+  if (control_[place.index] == kEmpty) {
+    --growth_left_;
+  }
+  set_control(place.index, h2(hash));
+  ++size_;
+
+  return std::pair<iterator, bool>(
+      iterator(control_ + place.index, slots_ + place.index), true);
+}
+
+// A lookup passes a group only if the group has no empty slot. If the
+// group of pos still has one, no probe sequence continues through it and
+// the slot may become empty again; otherwise it is marked deleted
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::erase(iterator pos) {
+  if (size_ == 0) {
+    throw std::out_of_range("Already empty");
+  } else if (pos == end()) {
+    throw std::out_of_range("End erase");
+  }
+
+  size_type index = size_type(pos.slot_ - slots_);
+  slots_[index].~value_type();
+  --size_;
+
+  size_type group = index / hash_group::kWidth * hash_group::kWidth;
+  if (hash_group(control_ + group).match_empty() != 0) {
+    set_control(index, kEmpty);
+    ++growth_left_;
+  } else {
+    set_control(index, kDeleted);
+  }
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::swap(hash_table &other) noexcept {
+  std::swap(control_, other.control_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(hash_, other.hash_);
+  std::swap(equal_, other.equal_);
+}
+
+// Erasing never moves the other values, so other is walked and thinned in
+// place
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::merge_unique(hash_table &other) {
+  if (this == &other) {
+    return;
+  }
+
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    if (try_emplace(KeyOf::key(*it), std::move(*it)).second) {
+      other.erase(it);
+    }
+  }
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::iterator
+hash_table<T, K, KeyOf, Hash, Equal>::find(const key_type &key) const {
+  if (size_ == 0) {
+    return end();
+  }
+
+  probe_result place = find_or_prepare(key, hash_of(key));
+  if (!place.found) {
+    return end();
+  }
+  return iterator(control_ + place.index, slots_ + place.index);
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+bool hash_table<T, K, KeyOf, Hash, Equal>::contains(
+    const key_type &key) const {
+  return find(key) != end();
+}
+
+// The mixed hash feeds h1 and h2 from all of its bits
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::size_type
+hash_table<T, K, KeyOf, Hash, Equal>::hash_of(const key_type &key) const {
+  return mix_hash(hash_(key));
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+signed char hash_table<T, K, KeyOf, Hash, Equal>::h2(size_type hash) noexcept {
+  return static_cast<signed char>(hash & 0x7F);
+}
+
+// Triangular steps over the groups visit every group of a power of two
+// count
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::probe_result
+hash_table<T, K, KeyOf, Hash, Equal>::find_or_prepare(const key_type &key,
+                                                      size_type hash) const {
+  size_type groups_mask = capacity_ / hash_group::kWidth - 1;
+  size_type group = (hash >> 7) & groups_mask;
+  size_type free_index = capacity_;
+  signed char tag = h2(hash);
+
+  for (size_type step = 1;; ++step) {
+    size_type offset = group * hash_group::kWidth;
+    hash_group probe(control_ + offset);
+    for (uint32_t mask = probe.match(tag); mask != 0; mask &= mask - 1) {
+      size_type index = offset + hash_group::lowest(mask);
+      if (equal_(KeyOf::key(slots_[index]), key)) {
+        return probe_result{index, true};
+      }
+    }
+    if (free_index == capacity_) {
+      uint32_t free_mask = probe.match_empty_or_deleted();
+      if (free_mask != 0) {
+        free_index = offset + hash_group::lowest(free_mask);
+      }
+    }
+    if (probe.match_empty() != 0 || step > groups_mask) {
+      return probe_result{free_index, false};
+    }
+    group = (group + step) & groups_mask;
+  }
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::set_control(
+    size_type index, signed char control) noexcept {
+  control_[index] = control;
+}
+
+// Values are moved into fresh slots; also run at the same capacity to
+// drop tombstones
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::rehash(size_type new_capacity) {
+  std::allocator<value_type> allocator;
+  value_type *new_slots = allocator.allocate(new_capacity);
+  signed char *new_control = nullptr;
+  try {
+    new_control = new signed char[new_capacity + 1];
+  } catch (...) {
+    allocator.deallocate(new_slots, new_capacity);
+    throw;
+  }
+  for (size_type i = 0; i < new_capacity; ++i) {
+    new_control[i] = kEmpty;
+  }
+  new_control[new_capacity] = kSentinel;
+
+  signed char *old_control = std::exchange(control_, new_control);
+  value_type *old_slots = std::exchange(slots_, new_slots);
+  size_type old_capacity = std::exchange(capacity_, new_capacity);
+  growth_left_ = new_capacity / kMaxLoadDen * kMaxLoadNum - size_;
+
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_control[i] < 0) {
+      continue;
+    }
+    size_type hash = hash_of(KeyOf::key(old_slots[i]));
+    size_type index = find_or_prepare(KeyOf::key(old_slots[i]), hash).index;
+    new (slots_ + index) value_type(std::move(old_slots[i]));
+    old_slots[i].~value_type();
+    set_control(index, h2(hash));
+  }
+
+  delete[] old_control;
+  if (old_slots != nullptr) {
+    allocator.deallocate(old_slots, old_capacity);
+  }
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+typename hash_table<T, K, KeyOf, Hash, Equal>::size_type
+hash_table<T, K, KeyOf, Hash, Equal>::capacity_for(size_type count) noexcept {
+  size_type capacity = hash_group::kWidth;
+  while (capacity / kMaxLoadDen * kMaxLoadNum < count) {
+    capacity *= 2;
+  }
+  return capacity;
+}
+
+template <class T, class K, class KeyOf, class Hash, class Equal>
+void hash_table<T, K, KeyOf, Hash, Equal>::release() noexcept {
+  if (control_ == nullptr) {
+    return;
+  }
+
+  clear();
+  delete[] control_;
+  std::allocator<value_type>().deallocate(slots_, capacity_);
+  control_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  growth_left_ = 0;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_HASH_TABLE_H_
@@ -44,10 +44,24 @@ class list : public forward_list<T> {
 
   using forward_list<T>::clear;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  // The value is constructed in the new node from args
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  // Each argument makes one element, they keep the argument order before pos.
+  // Returns the iterator to the first inserted element
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+  template <class... Args>
+  void insert_many_front(Args &&...args);
   void erase(iterator pos);
-  void push_back(const_reference val) override;
+  using forward_list<T>::push_back;
+  using forward_list<T>::push_front;
+  using forward_list<T>::emplace_back;
+  using forward_list<T>::emplace_front;
   void pop_back() override;
-  void push_front(const_reference val) override;
   void pop_front() override;
   // inherited swap()
   void merge(list &other);
@@ -98,7 +112,12 @@ class list : public forward_list<T> {
   };
 
  private:
-  list_node<T> *allocate_node(value_type value) const override;
+  [[nodiscard]] bool is_doubly_linked() const noexcept override;
+  void link_back(list_node<T> *new_node) override;
+  void link_front(list_node<T> *new_node) override;
+  // next is the node to go before, nullptr for the end
+  template <class... Args>
+  iterator emplace_before(list_node<T> *next, Args &&...args);
 };
 
 template <class T>
@@ -193,27 +212,51 @@ typename list<T>::size_type list<T>::max_size() const noexcept {
 template <class T>
 typename list<T>::iterator list<T>::insert(list::iterator pos,
                                            const_reference value) {
-  if (pos == begin()) {
-    push_front(value);
-    return iterator(this->head_, this->head_, this->tail_);
-  }
+  return emplace_before(pos.get_node(), value);
+}
 
-  if (pos == end()) {
-    push_back(value);
-    return iterator(this->tail_, this->head_, this->tail_);
-  }
+template <class T>
+typename list<T>::iterator list<T>::insert(list::iterator pos,
+                                           value_type &&value) {
+  return emplace_before(pos.get_node(), std::move(value));
+}
 
-  list_node<T> *temp = pos.get_node()->get_prev();
-  list_node<T> *new_node = allocate_node(value);
+template <class T>
+template <class... Args>
+typename list<T>::iterator list<T>::emplace(list::const_iterator pos,
+                                            Args &&...args) {
+  return emplace_before(pos.get_node(), std::forward<Args>(args)...);
+}
 
-  new_node->set_next(pos.get_node());
-  pos.get_node()->set_prev(new_node);
+template <class T>
+template <class... Args>
+typename list<T>::iterator list<T>::insert_many(list::const_iterator pos,
+                                                Args &&...args) {
+  list_node<T> *first = pos.get_node();
+  bool inserted = false;
+  (
+      [&] {
+        iterator it = emplace_before(pos.get_node(), std::forward<Args>(args));
+        if (!inserted) {
+          first = it.get_node();
+          inserted = true;
+        }
+      }(),
+      ...);
 
-  new_node->set_prev(temp);
-  temp->set_next(new_node);
+  return iterator(first, this->head_, this->tail_);
+}
 
-  ++this->size_;
-  return iterator(new_node, this->head_, this->tail_);
+template <class T>
+template <class... Args>
+void list<T>::insert_many_back(Args &&...args) {
+  (emplace_back(std::forward<Args>(args)), ...);
+}
+
+template <class T>
+template <class... Args>
+void list<T>::insert_many_front(Args &&...args) {
+  insert_many(cbegin(), std::forward<Args>(args)...);
 }
 
 template <class T>
@@ -243,9 +286,9 @@ void list<T>::erase(list::iterator pos) {
 }
 
 template <class T>
-void list<T>::push_back(const_reference val) {
+void list<T>::link_back(list_node<T> *new_node) {
   list_node<T> *temp = this->tail_;
-  forward_list<T>::push_back(val);
+  forward_list<T>::link_back(new_node);
   if (this->head_ != this->tail_) {
     this->tail_->set_prev(temp);
   }
@@ -264,9 +307,9 @@ void list<T>::pop_back() {
 }
 
 template <class T>
-void list<T>::push_front(const_reference val) {
+void list<T>::link_front(list_node<T> *new_node) {
   list_node<T> *temp = this->head_;
-  forward_list<T>::push_front(val);
+  forward_list<T>::link_front(new_node);
   if (this->head_ != this->tail_) {
     temp->set_prev(this->head_);
   }
@@ -443,16 +486,35 @@ typename list<T>::const_reference list<T>::ListConstIterator::operator*() {
 }
 
 template <class T>
-list_node<T> *list<T>::allocate_node(value_type value) const {
-  list_node<T> *new_node = nullptr;
+bool list<T>::is_doubly_linked() const noexcept {
+  return true;
+}
+
+template <class T>
+template <class... Args>
+typename list<T>::iterator list<T>::emplace_before(list_node<T> *next,
+                                                   Args &&...args) {
+  if (next == this->head_) {
+    emplace_front(std::forward<Args>(args)...);
+    return iterator(this->head_, this->head_, this->tail_);
+  }
 
-  try {
-    new_node = new binary_node<T>(value);
-  } catch (std::bad_alloc &e) {
-    std::throw_with_nested(e);
+  if (next == nullptr) {
+    emplace_back(std::forward<Args>(args)...);
+    return iterator(this->tail_, this->head_, this->tail_);
   }
 
-  return new_node;
+  list_node<T> *temp = next->get_prev();
+  list_node<T> *new_node = this->allocate_node(std::forward<Args>(args)...);
+
+  new_node->set_next(next);
+  next->set_prev(new_node);
+
+  new_node->set_prev(temp);
+  temp->set_next(new_node);
+
+  ++this->size_;
+  return iterator(new_node, this->head_, this->tail_);
 }
 
 }  // namespace s21
@@ -4,6 +4,7 @@
 #define SRC_SOURCE_NODE_H_
 
 #include <stdexcept>
+#include <utility>
 
 namespace s21 {
 
@@ -23,7 +24,10 @@ class list_node {
 template <class T>
 struct unary_node : public list_node<T> {
  public:
-  explicit unary_node(T value) : value_(value) {}
+  // The value is constructed from args in place
+  template <class... Args>
+  explicit unary_node(std::in_place_t, Args &&...args)
+      : value_(std::forward<Args>(args)...) {}
   unary_node<T> &operator=(const unary_node<T> &other) {
     if (this == &other) {
       return *this;
@@ -56,7 +60,9 @@ struct unary_node : public list_node<T> {
 template <class T>
 class binary_node : public unary_node<T> {
  public:
-  explicit binary_node(T value) : unary_node<T>(value) {}
+  template <class... Args>
+  explicit binary_node(std::in_place_t, Args &&...args)
+      : unary_node<T>(std::in_place, std::forward<Args>(args)...) {}
   binary_node<T> &operator=(const binary_node<T> &other) {
     if (this == &other) {
       return *this;
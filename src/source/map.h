@@ -3,16 +3,20 @@
 #ifndef SRC_SOURCE_MAP_H_
 #define SRC_SOURCE_MAP_H_
 
+#include <functional>
+#include <tuple>
 #include <utility>
 
 #include "bs_tree.h"
 #include "container.h"
 
 namespace s21 {
-template <class K, class T>
+template <class K, class T, class Compare = std::less<K>,
+          template <class> class Alloc = heap_node_allocator>
 class map : public container<T> {
  private:
   struct KeyTreeNode;
+  using tree_type = bs_tree<KeyTreeNode, K, std::pair<K, T>, Compare, Alloc>;
 
  public:
   using key_type = K;
@@ -20,14 +24,19 @@ class map : public container<T> {
   using value_type = std::pair<K, T>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator =
-      typename bs_tree<KeyTreeNode, key_type, value_type>::iterator;
-  using const_iterator =
-      typename bs_tree<KeyTreeNode, key_type, value_type>::const_iterator;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using size_type = size_t;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   map() noexcept = default;
   map(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  map(InputIt first, InputIt last);
+  template <class ForwardIt>
+  map(sorted_tag tag, ForwardIt first, ForwardIt last);
   map(const map &m);
   map(map &&m) noexcept;
 
@@ -51,72 +60,108 @@ class map : public container<T> {
   std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
   std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                              const mapped_type &obj);
+  insert_return_type insert(node_type &&node);
+  // hint is the element the new one goes before: sorted input inserted at
+  // end() skips the search. Return the element with the key either way
+  iterator insert(iterator hint, const value_type &value);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
   void erase(iterator pos);
+  node_type extract(iterator pos);
+  node_type extract(const key_type &key);
   void swap(map &other);
   void merge(map &other);
-
-  bool contains(const key_type &key);
+  template <class ForwardIt>
+  void bulk_load(ForwardIt first, ForwardIt last, sorted_tag tag);
+
+  iterator find(const key_type &key) const noexcept;
+  bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  // Element at position k in order, end() if k >= size(), and the number
+  // of keys less than key: O(log n) both
+  iterator nth(size_type k) const noexcept;
+  [[nodiscard]] size_type rank(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, enabled for transparent comparators only
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  bool contains(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] size_type count(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  key_compare key_comp() const;
 
  private:
   struct KeyTreeNode {
    public:
-    [[nodiscard]] key_type key() const noexcept;
+    [[nodiscard]] const key_type &key() const noexcept;
     KeyTreeNode() noexcept = default;
     KeyTreeNode(value_type value) noexcept;
+    KeyTreeNode(const key_type &key, const mapped_type &obj);
+    // The mapped value is default constructed in place
+    explicit KeyTreeNode(const key_type &key);
     value_type value_ = value_type();
   };
 
-  bs_tree<KeyTreeNode, key_type, value_type> tree_ =
-      bs_tree<KeyTreeNode, key_type, value_type>();
+  tree_type tree_ = tree_type();
 };
 
-template <class K, class T>
-typename map<K, T>::size_type map<K, T>::max_size() const noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::size_type
+map<K, T, Compare, Alloc>::max_size() const noexcept {
   return tree_.max_size();
 }
 
-template <class K, class T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert_or_assign(
-    const key_type &key, const mapped_type &obj) {
-  if (contains(key)) {
-    iterator res = tree_.find(key);
-    (*res).second = obj;
-    return std::pair<iterator, bool>(res, false);
+template <class K, class T, class Compare, template <class> class Alloc>
+std::pair<typename map<K, T, Compare, Alloc>::iterator, bool>
+map<K, T, Compare, Alloc>::insert_or_assign(const key_type &key,
+                                            const mapped_type &obj) {
+  std::pair<iterator, bool> result = tree_.try_emplace(key, key, obj);
+  if (!result.second) {
+    (*result.first).second = obj;
   }
-  return insert(key, obj);
+  return result;
 }
 
-template <class K, class T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert(
-    const key_type &key, const mapped_type &obj) {
-  if (!contains(key)) {
-    value_type value(key, obj);
-    return std::pair<iterator, bool>(tree_.insert(value), true);
+template <class K, class T, class Compare, template <class> class Alloc>
+std::pair<typename map<K, T, Compare, Alloc>::iterator, bool>
+map<K, T, Compare, Alloc>::insert(const key_type &key, const mapped_type &obj) {
+  std::pair<iterator, bool> result = tree_.try_emplace(key, key, obj);
+  if (!result.second) {
+    result.first = tree_.end();
   }
-  return std::pair<iterator, bool>(tree_.end(), false);
+  return result;
 }
 
-template <class K, class T>
-std::pair<typename map<K, T>::iterator, bool> map<K, T>::insert(
-    const map::value_type &value) {
-  if (!contains(value.first)) {
-    return std::pair<iterator, bool>(tree_.insert(value), true);
+template <class K, class T, class Compare, template <class> class Alloc>
+std::pair<typename map<K, T, Compare, Alloc>::iterator, bool>
+map<K, T, Compare, Alloc>::insert(const map::value_type &value) {
+  std::pair<iterator, bool> result = tree_.insert_unique(value);
+  if (!result.second) {
+    result.first = tree_.end();
   }
-  return std::pair<iterator, bool>(tree_.end(), false);
+  return result;
 }
 
-template <class K, class T>
-typename map<K, T>::mapped_type &map<K, T>::operator[](const key_type &key) {
-  iterator found = tree_.find(key);
-  if (found == end()) {
-    found = insert(key, mapped_type()).first;
-  }
-
-  return (*found).second;
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::mapped_type
+&map<K, T, Compare, Alloc>::operator[](const key_type &key) {
+  return (*tree_.try_emplace(key, key).first).second;
 }
 
-template <class K, class T>
-typename map<K, T>::mapped_type &map<K, T>::at(const key_type &key) {
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::mapped_type &map<K, T, Compare, Alloc>::at(
+    const key_type &key) {
   iterator found = tree_.find(key);
   if (found == end()) {
     throw std::out_of_range(
@@ -125,100 +170,258 @@ typename map<K, T>::mapped_type &map<K, T>::at(const key_type &key) {
   return (*found).second;
 }
 
-template <class K, class T>
-void map<K, T>::merge(map &other) {
-  map<K, T> res;
-  for (auto elem = other.begin(); elem != other.end(); ++elem) {
-    if (!insert(*elem).second) {
-      res.insert(*elem);
-    }
+// Nodes are relinked from other, keys already present here stay in other
+template <class K, class T, class Compare, template <class> class Alloc>
+void map<K, T, Compare, Alloc>::merge(map &other) {
+  tree_.merge_unique(other.tree_);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::insert_return_type
+map<K, T, Compare, Alloc>::insert(node_type &&node) {
+  return tree_.insert_unique(std::move(node));
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator map<K, T, Compare, Alloc>::insert(
+    iterator hint, const value_type &value) {
+  return tree_.try_emplace_hint(hint, value.first, value).first;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class... Args>
+typename map<K, T, Compare, Alloc>::iterator
+map<K, T, Compare, Alloc>::emplace_hint(iterator hint, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return tree_.try_emplace_hint(hint, value.first, std::move(value)).first;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::node_type
+map<K, T, Compare, Alloc>::extract(iterator pos) {
+  return tree_.extract(pos);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::node_type
+map<K, T, Compare, Alloc>::extract(const key_type &key) {
+  iterator found = tree_.find(key);
+  if (found == end()) {
+    return node_type();
   }
-  other = res;
+  return tree_.extract(found);
 }
 
-template <class K, class T>
-void map<K, T>::swap(map &other) {
+template <class K, class T, class Compare, template <class> class Alloc>
+void map<K, T, Compare, Alloc>::swap(map &other) {
   tree_.swap(other.tree_);
 }
 
-template <class K, class T>
-void map<K, T>::erase(map::iterator pos) {
+template <class K, class T, class Compare, template <class> class Alloc>
+void map<K, T, Compare, Alloc>::erase(map::iterator pos) {
   tree_.erase(pos);
 }
 
-template <class K, class T>
-bool map<K, T>::contains(const key_type &key) {
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator map<K, T, Compare, Alloc>::find(
+    const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+bool map<K, T, Compare, Alloc>::contains(const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::size_type map<K, T, Compare, Alloc>::count(
+    const key_type &key) const noexcept {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator
+map<K, T, Compare, Alloc>::lower_bound(const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator
+map<K, T, Compare, Alloc>::upper_bound(const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+std::pair<typename map<K, T, Compare, Alloc>::iterator,
+          typename map<K, T, Compare, Alloc>::iterator>
+map<K, T, Compare, Alloc>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator map<K, T, Compare, Alloc>::nth(
+    size_type k) const noexcept {
+  return tree_.nth(k);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::size_type map<K, T, Compare, Alloc>::rank(
+    const key_type &key) const noexcept {
+  return tree_.rank(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename map<K, T, Compare, Alloc>::iterator map<K, T, Compare, Alloc>::find(
+    const Key &key) const {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+bool map<K, T, Compare, Alloc>::contains(const Key &key) const {
   return tree_.contains(key);
 }
 
-template <class K, class T>
-typename map<K, T>::size_type map<K, T>::size() const noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename map<K, T, Compare, Alloc>::size_type map<K, T, Compare, Alloc>::count(
+    const Key &key) const {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename map<K, T, Compare, Alloc>::iterator
+map<K, T, Compare, Alloc>::lower_bound(const Key &key) const {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename map<K, T, Compare, Alloc>::iterator
+map<K, T, Compare, Alloc>::upper_bound(const Key &key) const {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+std::pair<typename map<K, T, Compare, Alloc>::iterator,
+          typename map<K, T, Compare, Alloc>::iterator>
+map<K, T, Compare, Alloc>::equal_range(const Key &key) const {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::key_compare
+map<K, T, Compare, Alloc>::key_comp() const {
+  return tree_.key_comp();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::size_type map<K, T, Compare, Alloc>::size()
+    const noexcept {
   return tree_.size();
 }
 
-template <class K, class T>
-bool map<K, T>::empty() const noexcept {
-  return size() == 0;
+template <class K, class T, class Compare, template <class> class Alloc>
+bool map<K, T, Compare, Alloc>::empty() const noexcept {
+  return tree_.empty();
 }
 
-template <class K, class T>
-typename map<K, T>::iterator map<K, T>::begin() const noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator map<K, T, Compare, Alloc>::begin()
+    const noexcept {
   return tree_.begin();
 }
 
-template <class K, class T>
-typename map<K, T>::iterator map<K, T>::end() const noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+typename map<K, T, Compare, Alloc>::iterator map<K, T, Compare, Alloc>::end()
+    const noexcept {
   return tree_.end();
 }
 
-template <class K, class T>
-map<K, T> &map<K, T>::operator=(map &&m) noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc> &map<K, T, Compare, Alloc>::operator=(
+    map &&m) noexcept {
   tree_ = std::move(m.tree_);
   return *this;
 }
 
-template <class K, class T>
-map<K, T> &map<K, T>::operator=(const map &m) {
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc> &map<K, T, Compare, Alloc>::operator=(const map &m) {
   tree_ = m.tree_;
   return *this;
 }
 
-template <class K, class T>
-map<K, T>::map(map &&m) noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::map(map &&m) noexcept {
   *this = std::move(m);
 }
 
-template <class K, class T>
-map<K, T>::map(const map &m) {
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::map(const map &m) {
   *this = m;
 }
 
-template <class K, class T>
-map<K, T>::map(const std::initializer_list<value_type> &items) {
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::map(const std::initializer_list<value_type> &items) {
   for (auto elem : items) {
-    insert(elem);
+    insert(end(), elem);
+  }
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class InputIt>
+map<K, T, Compare, Alloc>::map(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(end(), *first);
   }
 }
 
-template <class K, class T>
-void map<K, T>::clear() noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class ForwardIt>
+map<K, T, Compare, Alloc>::map(
+    sorted_tag tag, ForwardIt first, ForwardIt last) {
+  tree_.bulk_load(first, last, tag);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class ForwardIt>
+void map<K, T, Compare, Alloc>::bulk_load(
+    ForwardIt first, ForwardIt last, sorted_tag tag) {
+  tree_.bulk_load(first, last, tag);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+void map<K, T, Compare, Alloc>::clear() noexcept {
   tree_.clear();
 }
 
-template <class K, class T>
-map<K, T>::~map() noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::~map() noexcept {
   clear();
 }
 
-template <class K, class T>
-[[nodiscard]] typename map<K, T>::key_type map<K, T>::KeyTreeNode::key()
-    const noexcept {
+template <class K, class T, class Compare, template <class> class Alloc>
+[[nodiscard]] const typename map<K, T, Compare, Alloc>::key_type &
+map<K, T, Compare, Alloc>::KeyTreeNode::key() const noexcept {
   return value_.first;
 }
 
-template <class K, class T>
-map<K, T>::KeyTreeNode::KeyTreeNode(value_type value) noexcept
-    : value_(value) {}
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::KeyTreeNode::KeyTreeNode(value_type value) noexcept
+    : value_(std::move(value)) {}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::KeyTreeNode::KeyTreeNode(const key_type &key,
+                                                    const mapped_type &obj)
+    : value_(key, obj) {}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+map<K, T, Compare, Alloc>::KeyTreeNode::KeyTreeNode(const key_type &key)
+    : value_(std::piecewise_construct, std::forward_as_tuple(key),
+             std::tuple<>()) {}
 
 }  // namespace s21
 
@@ -0,0 +1,271 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_MULTIMAP_H_
+#define SRC_SOURCE_MULTIMAP_H_
+
+#include <functional>
+#include <utility>
+
+#include "bs_tree.h"
+#include "container.h"
+
+namespace s21 {
+
+// Key-value pairs sorted by key with equal keys allowed, pairs with equal
+// keys are kept in the order of insertion
+template <class K, class T, class Compare = std::less<K>,
+          template <class> class Alloc = heap_node_allocator>
+class multimap : public container<T> {
+ private:
+  struct KeyTreeNode;
+  using tree_type = bs_tree<KeyTreeNode, K, std::pair<K, T>, Compare, Alloc>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<K, T>;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+
+  multimap() noexcept = default;
+  multimap(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  multimap(InputIt first, InputIt last);
+  multimap(const multimap &other);
+  multimap(multimap &&other) noexcept;
+  multimap &operator=(const multimap &other);
+  multimap &operator=(multimap &&other) noexcept;
+
+  ~multimap() noexcept = default;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  [[nodiscard]] size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  iterator insert(const value_type &value);
+  iterator insert(const key_type &key, const mapped_type &obj);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(multimap &other) noexcept;
+  void merge(multimap &other);
+
+  // count and rank are O(log n), equal_range is O(log n) and erase(key) is
+  // O(log n) per erased element
+  iterator find(const key_type &key) const noexcept;
+  [[nodiscard]] bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  iterator nth(size_type k) const noexcept;
+  [[nodiscard]] size_type rank(const key_type &key) const noexcept;
+
+  key_compare key_comp() const;
+
+ private:
+  struct KeyTreeNode {
+   public:
+    [[nodiscard]] const key_type &key() const noexcept;
+    KeyTreeNode() noexcept = default;
+    KeyTreeNode(value_type value) noexcept;
+    KeyTreeNode(const key_type &key, const mapped_type &obj);
+    value_type value_ = value_type();
+  };
+
+  tree_type tree_ = tree_type();
+};
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc>::multimap(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &elem : items) {
+    insert(elem);
+  }
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+template <class InputIt>
+multimap<K, T, Compare, Alloc>::multimap(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(*first);
+  }
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc>::multimap(const multimap &other) {
+  *this = other;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc>::multimap(multimap &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc> &multimap<K, T, Compare, Alloc>::operator=(
+    const multimap &other) {
+  tree_ = other.tree_;
+  return *this;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc> &multimap<K, T, Compare, Alloc>::operator=(
+    multimap &&other) noexcept {
+  tree_ = std::move(other.tree_);
+  return *this;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::begin() const noexcept {
+  return tree_.begin();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::end() const noexcept {
+  return tree_.end();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+bool multimap<K, T, Compare, Alloc>::empty() const noexcept {
+  return tree_.empty();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::size_type
+multimap<K, T, Compare, Alloc>::size() const noexcept {
+  return tree_.size();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::size_type
+multimap<K, T, Compare, Alloc>::max_size() const noexcept {
+  return tree_.max_size();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+void multimap<K, T, Compare, Alloc>::clear() noexcept {
+  tree_.clear();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::insert(const value_type &value) {
+  return tree_.insert(KeyTreeNode(value));
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::insert(const key_type &key,
+                                       const mapped_type &obj) {
+  return tree_.insert(KeyTreeNode(key, obj));
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+void multimap<K, T, Compare, Alloc>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::size_type
+multimap<K, T, Compare, Alloc>::erase(const key_type &key) {
+  return tree_.erase_equal(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+void multimap<K, T, Compare, Alloc>::swap(multimap &other) noexcept {
+  tree_.swap(other.tree_);
+}
+
+// All nodes of other are relinked here, other is left empty
+template <class K, class T, class Compare, template <class> class Alloc>
+void multimap<K, T, Compare, Alloc>::merge(multimap &other) {
+  tree_.merge_equal(other.tree_);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::find(const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+bool multimap<K, T, Compare, Alloc>::contains(
+    const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::size_type
+multimap<K, T, Compare, Alloc>::count(const key_type &key) const noexcept {
+  return tree_.count(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::lower_bound(
+    const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::upper_bound(
+    const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+std::pair<typename multimap<K, T, Compare, Alloc>::iterator,
+          typename multimap<K, T, Compare, Alloc>::iterator>
+multimap<K, T, Compare, Alloc>::equal_range(
+    const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::iterator
+multimap<K, T, Compare, Alloc>::nth(size_type k) const noexcept {
+  return tree_.nth(k);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::size_type
+multimap<K, T, Compare, Alloc>::rank(const key_type &key) const noexcept {
+  return tree_.rank(key);
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+typename multimap<K, T, Compare, Alloc>::key_compare
+multimap<K, T, Compare, Alloc>::key_comp() const {
+  return tree_.key_comp();
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+const typename multimap<K, T, Compare, Alloc>::key_type &
+multimap<K, T, Compare, Alloc>::KeyTreeNode::key() const noexcept {
+  return value_.first;
+}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc>::KeyTreeNode::KeyTreeNode(
+    value_type value) noexcept
+    : value_(std::move(value)) {}
+
+template <class K, class T, class Compare, template <class> class Alloc>
+multimap<K, T, Compare, Alloc>::KeyTreeNode::KeyTreeNode(
+    const key_type &key, const mapped_type &obj)
+    : value_(key, obj) {}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_MULTIMAP_H_
@@ -0,0 +1,253 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_MULTISET_H_
+#define SRC_SOURCE_MULTISET_H_
+
+#include <functional>
+#include <utility>
+
+#include "bs_tree.h"
+#include "container.h"
+
+namespace s21 {
+
+// Sorted container with equal keys allowed, equal keys are kept in the
+// order of insertion
+template <class V, class Compare = std::less<V>,
+          template <class> class Alloc = heap_node_allocator>
+class multiset : public container<V> {
+ private:
+  struct KeyTreeNode;
+  using tree_type = bs_tree<KeyTreeNode, V, V, Compare, Alloc>;
+
+ public:
+  using value_type = V;
+  using key_type = V;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  multiset() noexcept = default;
+  multiset(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  multiset(InputIt first, InputIt last);
+  multiset(const multiset &other);
+  multiset(multiset &&other) noexcept;
+  multiset &operator=(const multiset &other);
+  multiset &operator=(multiset &&other) noexcept;
+
+  ~multiset() noexcept = default;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  [[nodiscard]] size_type max_size() const noexcept;
+
+  void clear() noexcept;
+  iterator insert(const value_type &value);
+  void erase(iterator pos);
+  size_type erase(const key_type &key);
+  void swap(multiset &other) noexcept;
+  void merge(multiset &other);
+
+  // count and rank are O(log n), equal_range is O(log n) and erase(key) is
+  // O(log n) per erased element
+  iterator find(const key_type &key) const noexcept;
+  [[nodiscard]] bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  iterator nth(size_type k) const noexcept;
+  [[nodiscard]] size_type rank(const key_type &key) const noexcept;
+
+  key_compare key_comp() const;
+
+ private:
+  struct KeyTreeNode {
+   public:
+    [[nodiscard]] const value_type &key() const noexcept;
+    KeyTreeNode() noexcept = default;
+    KeyTreeNode(value_type value) noexcept;
+    value_type value_ = value_type();
+  };
+
+  tree_type tree_ = tree_type();
+};
+
+template <class V, class Compare, template <class> class Alloc>
+multiset<V, Compare, Alloc>::multiset(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &elem : items) {
+    insert(elem);
+  }
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class InputIt>
+multiset<V, Compare, Alloc>::multiset(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(*first);
+  }
+}
+
+template <class V, class Compare, template <class> class Alloc>
+multiset<V, Compare, Alloc>::multiset(const multiset &other) {
+  *this = other;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+multiset<V, Compare, Alloc>::multiset(multiset &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+multiset<V, Compare, Alloc> &multiset<V, Compare, Alloc>::operator=(
+    const multiset &other) {
+  tree_ = other.tree_;
+  return *this;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+multiset<V, Compare, Alloc> &multiset<V, Compare, Alloc>::operator=(
+    multiset &&other) noexcept {
+  tree_ = std::move(other.tree_);
+  return *this;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::begin() const noexcept {
+  return tree_.begin();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::end() const noexcept {
+  return tree_.end();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+bool multiset<V, Compare, Alloc>::empty() const noexcept {
+  return tree_.empty();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::size_type
+multiset<V, Compare, Alloc>::size() const noexcept {
+  return tree_.size();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::size_type
+multiset<V, Compare, Alloc>::max_size() const noexcept {
+  return tree_.max_size();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+void multiset<V, Compare, Alloc>::clear() noexcept {
+  tree_.clear();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::insert(const value_type &value) {
+  return tree_.insert(KeyTreeNode(value));
+}
+
+template <class V, class Compare, template <class> class Alloc>
+void multiset<V, Compare, Alloc>::erase(iterator pos) {
+  tree_.erase(pos);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::size_type
+multiset<V, Compare, Alloc>::erase(const key_type &key) {
+  return tree_.erase_equal(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+void multiset<V, Compare, Alloc>::swap(multiset &other) noexcept {
+  tree_.swap(other.tree_);
+}
+
+// All nodes of other are relinked here, other is left empty
+template <class V, class Compare, template <class> class Alloc>
+void multiset<V, Compare, Alloc>::merge(multiset &other) {
+  tree_.merge_equal(other.tree_);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::find(const key_type &key) const noexcept {
+  return tree_.find(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+bool multiset<V, Compare, Alloc>::contains(
+    const key_type &key) const noexcept {
+  return tree_.contains(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::size_type
+multiset<V, Compare, Alloc>::count(const key_type &key) const noexcept {
+  return tree_.count(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::lower_bound(const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::upper_bound(const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+std::pair<typename multiset<V, Compare, Alloc>::iterator,
+          typename multiset<V, Compare, Alloc>::iterator>
+multiset<V, Compare, Alloc>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::iterator
+multiset<V, Compare, Alloc>::nth(size_type k) const noexcept {
+  return tree_.nth(k);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::size_type
+multiset<V, Compare, Alloc>::rank(const key_type &key) const noexcept {
+  return tree_.rank(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename multiset<V, Compare, Alloc>::key_compare
+multiset<V, Compare, Alloc>::key_comp() const {
+  return tree_.key_comp();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+const typename multiset<V, Compare, Alloc>::value_type &
+multiset<V, Compare, Alloc>::KeyTreeNode::key() const noexcept {
+  return value_;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+multiset<V, Compare, Alloc>::KeyTreeNode::KeyTreeNode(
+    value_type value) noexcept
+    : value_(std::move(value)) {}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_MULTISET_H_
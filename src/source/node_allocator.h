@@ -0,0 +1,248 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_NODE_ALLOCATOR_H_
+#define SRC_SOURCE_NODE_ALLOCATOR_H_
+
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Node allocators create and destroy the nodes of one tree, bs_tree takes
+// one of them as a template of its node type
+
+// Every node is a separate new and delete
+template <class Node>
+class heap_node_allocator {
+ public:
+  // Nodes have to be destroyed one by one
+  static constexpr bool kBulkRelease = false;
+
+  template <class... Args>
+  Node *create(Args &&...args);
+  void destroy(Node *node) noexcept;
+
+  bool operator==(const heap_node_allocator &other) const noexcept;
+};
+
+// Carves nodes out of slabs of kSlabNodes, so nodes created one after
+// another lie next to each other in memory. Destroyed nodes are reused
+// through a free list, slabs are freed together once no node is alive.
+// Copies share the pool: a node handle keeps one, so its node outlives
+// clear(), move or destruction of the tree it came from
+template <class Node>
+class pool_node_allocator {
+ public:
+  // Trivially destructible nodes may be dropped with release()
+  static constexpr bool kBulkRelease = true;
+  static constexpr size_t kSlabNodes = 1024;
+
+  pool_node_allocator() noexcept = default;
+  pool_node_allocator(const pool_node_allocator &other) noexcept;
+  pool_node_allocator(pool_node_allocator &&other) noexcept;
+  pool_node_allocator &operator=(const pool_node_allocator &other) noexcept;
+  pool_node_allocator &operator=(pool_node_allocator &&other) noexcept;
+  ~pool_node_allocator() noexcept;
+
+  template <class... Args>
+  Node *create(Args &&...args);
+  void destroy(Node *node) noexcept;
+  // Forgets count nodes without running their destructors. Their slots
+  // come back only when no node is left alive, so the caller must own all
+  // of them: compare with alive() first
+  void release(size_t count) noexcept;
+  // Nodes of the pool not destroyed yet, across all trees sharing it
+  size_t alive() const noexcept;
+
+  bool operator==(const pool_node_allocator &other) const noexcept;
+
+ private:
+  // Small nodes are padded to a power of two and aligned to it, so a node
+  // never straddles two cache lines
+  static constexpr size_t kCacheLine = 64;
+  static constexpr size_t slot_align(size_t size) noexcept;
+
+  union alignas(slot_align(sizeof(Node))) slot {
+    slot *next;
+    unsigned char storage[sizeof(Node)];
+  };
+
+  struct slab {
+    slab *next;
+    slot slots[kSlabNodes];
+  };
+
+  struct pool {
+    slab *slabs = nullptr;
+    slot *free = nullptr;
+    size_t used = kSlabNodes;  // slots handed out from the newest slab
+    size_t alive = 0;
+    size_t owners = 1;
+  };
+
+  pool *pool_ = nullptr;  // created by the first create()
+
+  void leave() noexcept;
+  static void free_slabs(pool *target) noexcept;
+};
+
+template <class Node>
+template <class... Args>
+Node *heap_node_allocator<Node>::create(Args &&...args) {
+  return new Node(std::forward<Args>(args)...);
+}
+
+template <class Node>
+void heap_node_allocator<Node>::destroy(Node *node) noexcept {
+  delete node;
+}
+
+template <class Node>
+bool heap_node_allocator<Node>::operator==(
+    const heap_node_allocator &other) const noexcept {
+  (void)other;
+  return true;
+}
+
+template <class Node>
+constexpr size_t pool_node_allocator<Node>::slot_align(size_t size) noexcept {
+  size_t align = alignof(Node);
+  while (align < size && align < kCacheLine) {
+    align *= 2;
+  }
+  return align;
+}
+
+template <class Node>
+pool_node_allocator<Node>::pool_node_allocator(
+    const pool_node_allocator &other) noexcept {
+  *this = other;
+}
+
+template <class Node>
+pool_node_allocator<Node>::pool_node_allocator(
+    pool_node_allocator &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class Node>
+pool_node_allocator<Node> &pool_node_allocator<Node>::operator=(
+    const pool_node_allocator &other) noexcept {
+  if (pool_ == other.pool_) {
+    return *this;
+  }
+
+  leave();
+  pool_ = other.pool_;
+  if (pool_ != nullptr) {
+    ++pool_->owners;
+  }
+
+  return *this;
+}
+
+template <class Node>
+pool_node_allocator<Node> &pool_node_allocator<Node>::operator=(
+    pool_node_allocator &&other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  leave();
+  pool_ = std::exchange(other.pool_, nullptr);
+
+  return *this;
+}
+
+template <class Node>
+pool_node_allocator<Node>::~pool_node_allocator() noexcept {
+  leave();
+}
+
+template <class Node>
+template <class... Args>
+Node *pool_node_allocator<Node>::create(Args &&...args) {
+  if (pool_ == nullptr) {
+    pool_ = new pool;
+  }
+
+  slot *place = pool_->free;
+  if (place != nullptr) {
+    pool_->free = place->next;
+  } else {
+    if (pool_->used == kSlabNodes) {
+      slab *fresh = new slab;
+      fresh->next = pool_->slabs;
+      pool_->slabs = fresh;
+      pool_->used = 0;
+    }
+    place = &pool_->slabs->slots[pool_->used++];
+  }
+
+  Node *node = nullptr;
+  try {
+    node = new (place->storage) Node(std::forward<Args>(args)...);
+  } catch (...) {
+    place->next = pool_->free;
+    pool_->free = place;
+    throw;
+  }
+  ++pool_->alive;
+
+  return node;
+}
+
+template <class Node>
+void pool_node_allocator<Node>::destroy(Node *node) noexcept {
+  node->~Node();
+  auto *place = reinterpret_cast<slot *>(node);
+  place->next = pool_->free;
+  pool_->free = place;
+  release(1);
+}
+
+template <class Node>
+void pool_node_allocator<Node>::release(size_t count) noexcept {
+  if (pool_ == nullptr) {
+    return;
+  }
+
+  pool_->alive -= count;
+  if (pool_->alive == 0) {
+    free_slabs(pool_);
+  }
+}
+
+template <class Node>
+size_t pool_node_allocator<Node>::alive() const noexcept {
+  return pool_ == nullptr ? 0 : pool_->alive;
+}
+
+template <class Node>
+bool pool_node_allocator<Node>::operator==(
+    const pool_node_allocator &other) const noexcept {
+  return pool_ == other.pool_;
+}
+
+template <class Node>
+void pool_node_allocator<Node>::leave() noexcept {
+  if (pool_ != nullptr && --pool_->owners == 0) {
+    free_slabs(pool_);
+    delete pool_;
+  }
+  pool_ = nullptr;
+}
+
+template <class Node>
+void pool_node_allocator<Node>::free_slabs(pool *target) noexcept {
+  while (target->slabs != nullptr) {
+    delete std::exchange(target->slabs, target->slabs->next);
+  }
+  target->free = nullptr;
+  target->used = kSlabNodes;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_NODE_ALLOCATOR_H_
@@ -0,0 +1,439 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_PERSISTENT_MAP_H_
+#define SRC_SOURCE_PERSISTENT_MAP_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "vector.h"
+
+namespace s21 {
+
+// Immutable ordered map: insert and erase leave *this untouched and return
+// a new version. Only the O(log n) nodes on the path to the key are copied,
+// the other subtrees are shared between versions through reference
+// counted pointers, and a node is freed with the last version using it.
+// Copying a map is the O(1) snapshot. The tree is an AVL tree, its nodes
+// never change after construction, so versions may be read from several
+// threads. Iterators are valid while the version they came from lives
+template <class K, class T, class Compare = std::less<K>>
+class persistent_map {
+ private:
+  struct node;
+  using node_ptr = std::shared_ptr<const node>;
+
+ public:
+  class PersistentIterator;
+
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<K, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using key_compare = Compare;
+  using iterator = PersistentIterator;
+  using const_iterator = PersistentIterator;
+  using size_type = size_t;
+
+  // In order walk over a version, keeps the nodes still to be returned
+  class PersistentIterator {
+   public:
+    const value_type &operator*() const;
+    iterator &operator++();
+    bool operator==(const iterator &other) const noexcept;
+    bool operator!=(const iterator &other) const noexcept;
+
+    PersistentIterator() = default;
+
+   private:
+    friend class persistent_map;
+
+    // the current node on top, below it the ancestors entered from the
+    // left; empty for end
+    vector<const node *> path_ = vector<const node *>();
+
+    void push_left_spine(const node *from);
+  };
+
+  persistent_map() noexcept = default;
+  persistent_map(std::initializer_list<value_type> const &items);
+  persistent_map(const persistent_map &other) = default;
+  persistent_map(persistent_map &&other) noexcept;
+  persistent_map &operator=(const persistent_map &other) = default;
+  persistent_map &operator=(persistent_map &&other) noexcept;
+
+  ~persistent_map() noexcept = default;
+
+  const mapped_type &at(const key_type &key) const;
+
+  iterator begin() const;
+  iterator end() const;
+
+  [[nodiscard]] bool empty() const noexcept;
+  [[nodiscard]] size_type size() const noexcept;
+
+  // Versions with the change applied, *this stays as it was. insert keeps
+  // a present value, erase of an absent key returns an equal version
+  [[nodiscard]] persistent_map insert(const value_type &value) const;
+  [[nodiscard]] persistent_map insert(const key_type &key,
+                                      const mapped_type &obj) const;
+  [[nodiscard]] persistent_map insert_or_assign(const key_type &key,
+                                                const mapped_type &obj) const;
+  [[nodiscard]] persistent_map erase(const key_type &key) const;
+
+  iterator find(const key_type &key) const;
+  [[nodiscard]] bool contains(const key_type &key) const;
+  [[nodiscard]] size_type count(const key_type &key) const;
+
+  key_compare key_comp() const;
+
+ private:
+  struct node {
+    node(value_type value, node_ptr left, node_ptr right);
+
+    value_type value_;
+    node_ptr left_;
+    node_ptr right_;
+    int height_;
+  };
+
+  node_ptr root_ = nullptr;
+  size_type size_ = 0;
+  Compare compare_ = Compare();
+
+  persistent_map(node_ptr root, size_type size, const Compare &compare);
+
+  const node *find_node(const key_type &key) const;
+  node_ptr insert_into(const node_ptr &from, const key_type &key,
+                       const mapped_type &obj, bool assign,
+                       bool &added) const;
+  // key must be present
+  node_ptr erase_from(const node_ptr &from, const key_type &key) const;
+  // Copy of from without its leftmost node, whose value goes to min
+  static node_ptr erase_min(const node_ptr &from, const node *&min);
+
+  static int height(const node_ptr &of) noexcept;
+  static node_ptr make(value_type value, node_ptr left, node_ptr right);
+  // make plus at most two rotations, the subtree heights may differ by two
+  static node_ptr balance(value_type value, node_ptr left, node_ptr right);
+};
+
+template <class K, class T, class Compare>
+const typename persistent_map<K, T, Compare>::value_type &
+persistent_map<K, T, Compare>::iterator::operator*() const {
+  return path_.back()->value_;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::iterator &
+persistent_map<K, T, Compare>::iterator::operator++() {
+  const node *current = path_.back();
+  path_.pop_back();
+  push_left_spine(current->right_.get());
+  return *this;
+}
+
+template <class K, class T, class Compare>
+bool persistent_map<K, T, Compare>::iterator::operator==(
+    const iterator &other) const noexcept {
+  if (path_.empty() || other.path_.empty()) {
+    return path_.empty() && other.path_.empty();
+  }
+  return path_.back() == other.path_.back();
+}
+
+template <class K, class T, class Compare>
+bool persistent_map<K, T, Compare>::iterator::operator!=(
+    const iterator &other) const noexcept {
+  return !(*this == other);
+}
+
+template <class K, class T, class Compare>
+void persistent_map<K, T, Compare>::iterator::push_left_spine(
+    const node *from) {
+  for (; from != nullptr; from = from->left_.get()) {
+    path_.push_back(from);
+  }
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare>::persistent_map(
+    std::initializer_list<value_type> const &items) {
+  for (const auto &elem : items) {
+    *this = insert(elem);
+  }
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare>::persistent_map(persistent_map &&other) noexcept
+    : root_(std::move(other.root_)),
+      size_(std::exchange(other.size_, 0)),
+      compare_(other.compare_) {}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare> &persistent_map<K, T, Compare>::operator=(
+    persistent_map &&other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+
+  root_ = std::move(other.root_);
+  size_ = std::exchange(other.size_, 0);
+  compare_ = other.compare_;
+
+  return *this;
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare>::persistent_map(node_ptr root, size_type size,
+                                              const Compare &compare)
+    : root_(std::move(root)), size_(size), compare_(compare) {}
+
+template <class K, class T, class Compare>
+const typename persistent_map<K, T, Compare>::mapped_type &
+persistent_map<K, T, Compare>::at(const key_type &key) const {
+  const node *found = find_node(key);
+  if (found == nullptr) {
+    throw std::out_of_range(
+        "Container does not have an element with the specified key");
+  }
+  return found->value_.second;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::iterator
+persistent_map<K, T, Compare>::begin() const {
+  iterator first;
+  first.push_left_spine(root_.get());
+  return first;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::iterator
+persistent_map<K, T, Compare>::end() const {
+  return iterator();
+}
+
+template <class K, class T, class Compare>
+bool persistent_map<K, T, Compare>::empty() const noexcept {
+  return size_ == 0;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::size_type
+persistent_map<K, T, Compare>::size() const noexcept {
+  return size_;
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare> persistent_map<K, T, Compare>::insert(
+    const value_type &value) const {
+  return insert(value.first, value.second);
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare> persistent_map<K, T, Compare>::insert(
+    const key_type &key, const mapped_type &obj) const {
+  if (contains(key)) {
+    return *this;
+  }
+
+  bool added = false;
+  node_ptr root = insert_into(root_, key, obj, false, added);
+  return persistent_map(std::move(root), size_ + 1, compare_);
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare> persistent_map<K, T, Compare>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) const {
+  bool added = false;
+  node_ptr root = insert_into(root_, key, obj, true, added);
+  return persistent_map(std::move(root), added ? size_ + 1 : size_, compare_);
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare> persistent_map<K, T, Compare>::erase(
+    const key_type &key) const {
+  if (!contains(key)) {
+    return *this;
+  }
+
+  node_ptr root = erase_from(root_, key);
+  return persistent_map(std::move(root), size_ - 1, compare_);
+}
+
+// Goes down like begin() does, but only keeps the ancestors entered from
+// the left, which are exactly the nodes after key in order
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::iterator
+persistent_map<K, T, Compare>::find(const key_type &key) const {
+  iterator found;
+  const node *current = root_.get();
+  while (current != nullptr) {
+    if (compare_(key, current->value_.first)) {
+      found.path_.push_back(current);
+      current = current->left_.get();
+    } else if (compare_(current->value_.first, key)) {
+      current = current->right_.get();
+    } else {
+      found.path_.push_back(current);
+      return found;
+    }
+  }
+
+  return end();
+}
+
+template <class K, class T, class Compare>
+bool persistent_map<K, T, Compare>::contains(const key_type &key) const {
+  return find_node(key) != nullptr;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::size_type
+persistent_map<K, T, Compare>::count(const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::key_compare
+persistent_map<K, T, Compare>::key_comp() const {
+  return compare_;
+}
+
+template <class K, class T, class Compare>
+persistent_map<K, T, Compare>::node::node(value_type value, node_ptr left,
+                                          node_ptr right)
+    : value_(std::move(value)),
+      left_(std::move(left)),
+      right_(std::move(right)),
+      height_(std::max(height(left_), height(right_)) + 1) {}
+
+template <class K, class T, class Compare>
+const typename persistent_map<K, T, Compare>::node *
+persistent_map<K, T, Compare>::find_node(const key_type &key) const {
+  const node *current = root_.get();
+  while (current != nullptr) {
+    if (compare_(key, current->value_.first)) {
+      current = current->left_.get();
+    } else if (compare_(current->value_.first, key)) {
+      current = current->right_.get();
+    } else {
+      return current;
+    }
+  }
+
+  return nullptr;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::node_ptr
+persistent_map<K, T, Compare>::insert_into(const node_ptr &from,
+                                           const key_type &key,
+                                           const mapped_type &obj, bool assign,
+                                           bool &added) const {
+  if (from == nullptr) {
+    added = true;
+    return make(value_type(key, obj), nullptr, nullptr);
+  }
+
+  if (compare_(key, from->value_.first)) {
+    return balance(from->value_,
+                   insert_into(from->left_, key, obj, assign, added),
+                   from->right_);
+  }
+  if (compare_(from->value_.first, key)) {
+    return balance(from->value_, from->left_,
+                   insert_into(from->right_, key, obj, assign, added));
+  }
+  if (!assign) {
+    return from;
+  }
+  return make(value_type(key, obj), from->left_, from->right_);
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::node_ptr
+persistent_map<K, T, Compare>::erase_from(const node_ptr &from,
+                                          const key_type &key) const {
+  if (compare_(key, from->value_.first)) {
+    return balance(from->value_, erase_from(from->left_, key), from->right_);
+  }
+  if (compare_(from->value_.first, key)) {
+    return balance(from->value_, from->left_, erase_from(from->right_, key));
+  }
+
+  if (from->left_ == nullptr) {
+    return from->right_;
+  }
+  if (from->right_ == nullptr) {
+    return from->left_;
+  }
+  // the successor takes the place of the erased node
+  const node *min = nullptr;
+  node_ptr right = erase_min(from->right_, min);
+  return balance(min->value_, from->left_, std::move(right));
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::node_ptr
+persistent_map<K, T, Compare>::erase_min(const node_ptr &from,
+                                         const node *&min) {
+  if (from->left_ == nullptr) {
+    min = from.get();
+    return from->right_;
+  }
+
+  return balance(from->value_, erase_min(from->left_, min), from->right_);
+}
+
+template <class K, class T, class Compare>
+int persistent_map<K, T, Compare>::height(const node_ptr &of) noexcept {
+  return of == nullptr ? 0 : of->height_;
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::node_ptr
+persistent_map<K, T, Compare>::make(value_type value, node_ptr left,
+                                    node_ptr right) {
+  return std::make_shared<const node>(std::move(value), std::move(left),
+                                      std::move(right));
+}
+
+template <class K, class T, class Compare>
+typename persistent_map<K, T, Compare>::node_ptr
+persistent_map<K, T, Compare>::balance(value_type value, node_ptr left,
+                                       node_ptr right) {
+  if (height(left) > height(right) + 1) {
+    if (height(left->left_) >= height(left->right_)) {
+      return make(left->value_, left->left_,
+                  make(std::move(value), left->right_, std::move(right)));
+    }
+    const node_ptr &middle = left->right_;
+    return make(middle->value_,
+                make(left->value_, left->left_, middle->left_),
+                make(std::move(value), middle->right_, std::move(right)));
+  }
+  if (height(right) > height(left) + 1) {
+    if (height(right->right_) >= height(right->left_)) {
+      return make(right->value_,
+                  make(std::move(value), std::move(left), right->left_),
+                  right->right_);
+    }
+    const node_ptr &middle = right->left_;
+    return make(middle->value_,
+                make(std::move(value), std::move(left), middle->left_),
+                make(right->value_, middle->right_, right->right_));
+  }
+
+  return make(std::move(value), std::move(left), std::move(right));
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_PERSISTENT_MAP_H_
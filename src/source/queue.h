@@ -31,6 +31,13 @@ class queue : public forward_list<T> {
   // inherited empty() and size()
 
   void push(const_reference value);
+  void push(value_type &&value);
+  // The value is constructed in the new node from args
+  template <class... Args>
+  void emplace(Args &&...args);
+  // Each argument makes one element, pushed in the argument order
+  template <class... Args>
+  void insert_many_back(Args &&...args);
   void pop();
   // inherited swap()
 };
@@ -91,6 +98,23 @@ void queue<T>::push(const_reference value) {
   this->push_back(value);
 }
 
+template <class T>
+void queue<T>::push(value_type &&value) {
+  this->push_back(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+void queue<T>::emplace(Args &&...args) {
+  this->emplace_back(std::forward<Args>(args)...);
+}
+
+template <class T>
+template <class... Args>
+void queue<T>::insert_many_back(Args &&...args) {
+  (this->emplace_back(std::forward<Args>(args)), ...);
+}
+
 template <class T>
 void queue<T>::pop() {
   this->pop_front();
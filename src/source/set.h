@@ -3,30 +3,39 @@
 #ifndef SRC_SOURCE_SET_H_
 #define SRC_SOURCE_SET_H_
 
+#include <functional>
 #include <utility>
 
 #include "bs_tree.h"
+#include "frozen_set.h"
 
 namespace s21 {
 
-template <class V>
+template <class V, class Compare = std::less<V>,
+          template <class> class Alloc = heap_node_allocator>
 class set : public container<V> {
  private:
   struct KeyTreeNode;
+  using tree_type = bs_tree<KeyTreeNode, V, V, Compare, Alloc>;
 
  public:
   using value_type = V;
   using key_type = V;
-  using iterator =
-      typename bs_tree<KeyTreeNode, key_type, value_type>::iterator;
-  using const_iterator =
-      typename bs_tree<KeyTreeNode, key_type, value_type>::const_iterator;
+  using key_compare = Compare;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
   using reference = V &;
   using const_reference = const V &;
   using size_type = size_t;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   set() noexcept = default;
   set(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  set(InputIt first, InputIt last);
+  template <class ForwardIt>
+  set(sorted_tag tag, ForwardIt first, ForwardIt last);
   set(const set &other);
   set(set &&other) noexcept;
   set &operator=(const set &s) noexcept;
@@ -43,132 +52,317 @@ class set : public container<V> {
 
   void clear() noexcept;
   std::pair<iterator, bool> insert(const value_type &value);
+  insert_return_type insert(node_type &&node);
+  // hint is the element the new one goes before: sorted input inserted at
+  // end() skips the search. Return the element with the key either way
+  iterator insert(iterator hint, const value_type &value);
+  template <class... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
   void erase(iterator pos);
+  node_type extract(iterator pos);
+  node_type extract(const key_type &key);
   void swap(set &other) noexcept;
   void merge(set &other);
+  template <class ForwardIt>
+  void bulk_load(ForwardIt first, ForwardIt last, sorted_tag tag);
+  // Read-only copy laid out for lookups, see frozen_set
+  frozen_set<V, Compare> freeze() const;
 
   iterator find(const key_type &key) const noexcept;
   [[nodiscard]] bool contains(const key_type &key) const noexcept;
+  [[nodiscard]] size_type count(const key_type &key) const noexcept;
+  iterator lower_bound(const key_type &key) const noexcept;
+  iterator upper_bound(const key_type &key) const noexcept;
+  std::pair<iterator, iterator> equal_range(const key_type &key) const noexcept;
+  // Element at position k in order, end() if k >= size(), and the number
+  // of keys less than key: O(log n) both
+  iterator nth(size_type k) const noexcept;
+  [[nodiscard]] size_type rank(const key_type &key) const noexcept;
+
+  // Heterogeneous lookup, enabled for transparent comparators only
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator find(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] bool contains(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  [[nodiscard]] size_type count(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const Key &key) const;
+  template <class Key, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const Key &key) const;
+
+  key_compare key_comp() const;
 
  private:
   struct KeyTreeNode {
    public:
     using value_type = V;
-    [[nodiscard]] value_type key() const noexcept;
+    [[nodiscard]] const value_type &key() const noexcept;
     KeyTreeNode() noexcept = default;
     KeyTreeNode(value_type value) noexcept;
     value_type value_ = value_type();
   };
 
-  bs_tree<KeyTreeNode, key_type, value_type> tree_ =
-      bs_tree<KeyTreeNode, key_type, value_type>();
+  tree_type tree_ = tree_type();
 };
 
-template <class V>
-set<V>::set(const set &other) {
+template <class V, class Compare, template <class> class Alloc>
+template <class InputIt>
+set<V, Compare, Alloc>::set(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(end(), *first);
+  }
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class ForwardIt>
+set<V, Compare, Alloc>::set(sorted_tag tag, ForwardIt first, ForwardIt last) {
+  tree_.bulk_load(first, last, tag);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+set<V, Compare, Alloc>::set(const set &other) {
   *this = other;
 }
 
-template <class V>
-set<V>::set(set &&other) noexcept {
+template <class V, class Compare, template <class> class Alloc>
+set<V, Compare, Alloc>::set(set &&other) noexcept {
   *this = std::move(other);
 }
 
-template <class V>
-set<V> &set<V>::operator=(const set &s) noexcept {
+template <class V, class Compare, template <class> class Alloc>
+set<V, Compare, Alloc> &set<V, Compare, Alloc>::operator=(
+    const set &s) noexcept {
   tree_ = s.tree_;
   return *this;
 }
 
-template <class V>
-set<V> &set<V>::operator=(set &&s) noexcept {
+template <class V, class Compare, template <class> class Alloc>
+set<V, Compare, Alloc> &set<V, Compare, Alloc>::operator=(set &&s) noexcept {
   tree_ = std::move(s.tree_);
   return *this;
 }
 
-template <class V>
-typename set<V>::iterator set<V>::begin() const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::begin()
+    const noexcept {
   return tree_.begin();
 }
 
-template <class V>
-typename set<V>::iterator set<V>::end() const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::end()
+    const noexcept {
   return tree_.end();
 }
 
-template <class V>
-bool set<V>::empty() const noexcept {
-  return size() == 0;
+template <class V, class Compare, template <class> class Alloc>
+bool set<V, Compare, Alloc>::empty() const noexcept {
+  return tree_.empty();
 }
 
-template <class V>
-typename set<V>::size_type set<V>::size() const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::size_type set<V, Compare, Alloc>::size()
+    const noexcept {
   return tree_.size();
 }
 
-template <class V>
-typename set<V>::size_type set<V>::max_size() const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::size_type set<V, Compare, Alloc>::max_size()
+    const noexcept {
   return tree_.max_size();
 }
 
-template <class V>
-void set<V>::clear() noexcept {
+template <class V, class Compare, template <class> class Alloc>
+void set<V, Compare, Alloc>::clear() noexcept {
   tree_.clear();
 }
 
-template <class V>
-void set<V>::erase(set::iterator pos) {
+template <class V, class Compare, template <class> class Alloc>
+void set<V, Compare, Alloc>::erase(set::iterator pos) {
   tree_.erase(pos);
 }
 
-template <class V>
-void set<V>::swap(set &other) noexcept {
+template <class V, class Compare, template <class> class Alloc>
+void set<V, Compare, Alloc>::swap(set &other) noexcept {
   tree_.swap(other.tree_);
 }
 
-template <class V>
-void set<V>::merge(set &other) {
-  set<V> res;
-  for (auto elem = other.begin(); elem != other.end(); ++elem) {
-    if (!insert(*elem).second) {
-      res.insert(*elem);
-    }
+// Nodes are relinked from other, keys already present here stay in other
+template <class V, class Compare, template <class> class Alloc>
+void set<V, Compare, Alloc>::merge(set &other) {
+  tree_.merge_unique(other.tree_);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::insert_return_type
+set<V, Compare, Alloc>::insert(node_type &&node) {
+  return tree_.insert_unique(std::move(node));
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::insert(
+    iterator hint, const value_type &value) {
+  return tree_.try_emplace_hint(hint, value, value).first;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class... Args>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::emplace_hint(
+    iterator hint, Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return tree_.try_emplace_hint(hint, value, std::move(value)).first;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::node_type set<V, Compare, Alloc>::extract(
+    iterator pos) {
+  return tree_.extract(pos);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::node_type set<V, Compare, Alloc>::extract(
+    const key_type &key) {
+  iterator found = tree_.find(key);
+  if (found == end()) {
+    return node_type();
   }
-  other = res;
+  return tree_.extract(found);
 }
 
-template <class V>
-bool set<V>::contains(const key_type &key) const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+template <class ForwardIt>
+void set<V, Compare, Alloc>::bulk_load(
+    ForwardIt first, ForwardIt last, sorted_tag tag) {
+  tree_.bulk_load(first, last, tag);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+frozen_set<V, Compare> set<V, Compare, Alloc>::freeze() const {
+  return frozen_set<V, Compare>(kSorted, begin(), end());
+}
+
+template <class V, class Compare, template <class> class Alloc>
+bool set<V, Compare, Alloc>::contains(const key_type &key) const noexcept {
   return tree_.contains(key);
 }
 
-template <class V>
-typename set<V>::iterator set<V>::find(const key_type &key) const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::find(
+    const key_type &key) const noexcept {
   return tree_.find(key);
 }
 
-template <class V>
-[[nodiscard]] typename set<V>::value_type set<V>::KeyTreeNode::key()
-    const noexcept {
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::size_type set<V, Compare, Alloc>::count(
+    const key_type &key) const noexcept {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::lower_bound(
+    const key_type &key) const noexcept {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::upper_bound(
+    const key_type &key) const noexcept {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+std::pair<typename set<V, Compare, Alloc>::iterator,
+          typename set<V, Compare, Alloc>::iterator>
+set<V, Compare, Alloc>::equal_range(const key_type &key) const noexcept {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::nth(
+    size_type k) const noexcept {
+  return tree_.nth(k);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::size_type set<V, Compare, Alloc>::rank(
+    const key_type &key) const noexcept {
+  return tree_.rank(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::find(
+    const Key &key) const {
+  return tree_.find(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+bool set<V, Compare, Alloc>::contains(const Key &key) const {
+  return tree_.contains(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename set<V, Compare, Alloc>::size_type set<V, Compare, Alloc>::count(
+    const Key &key) const {
+  return tree_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::lower_bound(
+    const Key &key) const {
+  return tree_.lower_bound(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+typename set<V, Compare, Alloc>::iterator set<V, Compare, Alloc>::upper_bound(
+    const Key &key) const {
+  return tree_.upper_bound(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+template <class Key, class C, class>
+std::pair<typename set<V, Compare, Alloc>::iterator,
+          typename set<V, Compare, Alloc>::iterator>
+set<V, Compare, Alloc>::equal_range(const Key &key) const {
+  return tree_.equal_range(key);
+}
+
+template <class V, class Compare, template <class> class Alloc>
+typename set<V, Compare, Alloc>::key_compare set<V, Compare, Alloc>::key_comp()
+    const {
+  return tree_.key_comp();
+}
+
+template <class V, class Compare, template <class> class Alloc>
+[[nodiscard]] const typename set<V, Compare, Alloc>::value_type &
+set<V, Compare, Alloc>::KeyTreeNode::key() const noexcept {
   return value_;
 }
 
-template <class V>
-set<V>::KeyTreeNode::KeyTreeNode(value_type value) noexcept : value_(value) {}
+template <class V, class Compare, template <class> class Alloc>
+set<V, Compare, Alloc>::KeyTreeNode::KeyTreeNode(value_type value) noexcept
+    : value_(std::move(value)) {}
 
-template <class V>
-std::pair<typename set<V>::iterator, bool> set<V>::insert(
-    const value_type &value) {
-  if (!contains(value)) {
-    return std::pair<iterator, bool>(tree_.insert(value), true);
+template <class V, class Compare, template <class> class Alloc>
+std::pair<typename set<V, Compare, Alloc>::iterator, bool>
+set<V, Compare, Alloc>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = tree_.insert_unique(value);
+  if (!result.second) {
+    result.first = tree_.end();
   }
-  return std::pair<iterator, bool>(tree_.end(), false);
+  return result;
 }
 
-template <class V>
-set<V>::set(std::initializer_list<value_type> const &items) {
+template <class V, class Compare, template <class> class Alloc>
+set<V, Compare, Alloc>::set(std::initializer_list<value_type> const &items) {
   for (auto elem : items) {
-    insert(elem);
+    insert(end(), elem);
   }
 }
 
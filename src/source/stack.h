@@ -30,6 +30,13 @@ class stack : public forward_list<T> {
   // inherited empty() and size()
 
   void push(const_reference value);
+  void push(value_type &&value);
+  // The value is constructed in the new node from args
+  template <class... Args>
+  void emplace(Args &&...args);
+  // Each argument makes one element, pushed in the argument order
+  template <class... Args>
+  void insert_many_front(Args &&...args);
   void pop();
   // inherited swap()
 };
@@ -95,6 +102,23 @@ void stack<T>::push(const_reference value) {
   this->push_front(value);
 }
 
+template <class T>
+void stack<T>::push(value_type &&value) {
+  this->push_front(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+void stack<T>::emplace(Args &&...args) {
+  this->emplace_front(std::forward<Args>(args)...);
+}
+
+template <class T>
+template <class... Args>
+void stack<T>::insert_many_front(Args &&...args) {
+  (this->emplace_front(std::forward<Args>(args)), ...);
+}
+
 template <class T>
 void stack<T>::pop() {
   this->pop_front();
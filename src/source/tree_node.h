@@ -7,8 +7,11 @@
 #include <utility>
 
 namespace s21 {
-template <class V, class K, class T>  // V must be class(contains node_ and
-                                      // key_type key()), K - key_type
+
+enum class node_color { kRed, kBlack };
+
+// V must be class(contains value_ and const key_type &key()), K - key_type
+template <class V, class K, class T>
 class tree_node {
  public:
   class TreeIterator;
@@ -35,57 +38,57 @@ class tree_node {
     bool operator==(const iterator &other) const noexcept;
     bool operator!=(const iterator &other) const noexcept;
 
-    TreeIterator(tree_node *node, bool end_iterator) noexcept;
     TreeIterator(tree_node *node) noexcept;
     TreeIterator() noexcept = default;
 
     tree_node *get_node() const noexcept;
 
    private:
-    tree_node *node_ = nullptr;
-    bool end_iterator_ = false;
+    tree_node *node_ = nullptr;  // the tree header for the end iterator
   };
 
   class TreeConstIterator : public TreeIterator {
+   public:
+    using TreeIterator::TreeIterator;
     const obj_type &operator*();
-
-   private:
-    tree_node *node_ = nullptr;
-    bool end_iterator_ = false;
   };
 
   tree_node() noexcept = default;
   explicit tree_node(value_type value) noexcept;
   tree_node(value_type value, tree_node *parent) noexcept;
-  tree_node(const tree_node &other);
+  // Nodes are owned and linked by bs_tree: they are not copyable and do not
+  // destroy their children
+  tree_node(const tree_node &other) = delete;
+  tree_node &operator=(const tree_node &other) = delete;
 
-  tree_node &operator=(const tree_node &other);
-
-  ~tree_node() noexcept;
-
-  [[nodiscard]] size_type size() const noexcept;
-
-  void clear() noexcept;
-  iterator insert(const value_type &value);
-  void erase(iterator pos);
-
-  iterator find(const key_type &key) noexcept;
+  ~tree_node() noexcept = default;
 
   tree_node *get_left() const noexcept;
   tree_node *get_right() const noexcept;
   tree_node *get_parent() const noexcept;
+  node_color get_color() const noexcept;
+  size_type get_size() const noexcept;
   value_type &get_value() noexcept;
 
-  tree_node *front() noexcept;
-  tree_node *back() noexcept;
+  void set_left(tree_node *node) noexcept;
+  void set_right(tree_node *node) noexcept;
+  void set_parent(tree_node *node) noexcept;
+  void set_color(node_color color) noexcept;
+  void set_size(size_type size) noexcept;
+
+  [[nodiscard]] bool is_header() const noexcept;
+  // Number of nodes in the subtree of node, 0 for nullptr
+  static size_type subtree_size(const tree_node *node) noexcept;
+  // The node at in-order position k of the subtree, k < subtree_size(node)
+  static tree_node *select(tree_node *node, size_type k) noexcept;
 
  private:
   value_type value_ = value_type();
   tree_node *left_ = nullptr;
   tree_node *right_ = nullptr;
   tree_node *parent_ = nullptr;
-
-  tree_node *find_place(const key_type &key) noexcept;
+  node_color color_ = node_color::kRed;
+  size_type size_ = 1;  // nodes in the subtree rooted here, kept by bs_tree
 };
 
 template <class V, class K, class T>
@@ -97,29 +100,26 @@ tree_node<V, K, T>::iterator::operator*() {
 template <class V, class K, class T>
 const typename tree_node<V, K, T>::obj_type &
 tree_node<V, K, T>::TreeConstIterator::operator*() {
-  return node_->get_value().value_;
+  return this->get_node()->get_value().value_;
 }
 
 template <class V, class K, class T>
 typename tree_node<V, K, T>::iterator &
 tree_node<V, K, T>::iterator::operator--() {
-  if (end_iterator_) {
-    end_iterator_ = false;
-    node_ = node_->back();
-  } else if (node_ == node_->front()) {
-    end_iterator_ = true;
+  if (node_->is_header()) {
+    node_ = node_->get_right();
   } else if (node_->get_left() != nullptr) {
     node_ = node_->get_left();
     while (node_->get_right()) {
       node_ = node_->get_right();
     }
   } else {
-    while (node_->get_parent() && node_->get_parent()->get_left() == node_) {
-      node_ = node_->get_parent();
-    }
-    if (node_->get_parent() && node_ == node_->get_parent()->get_right()) {
-      node_ = node_->get_parent();
+    tree_node *parent = node_->get_parent();
+    while (node_ == parent->get_left()) {
+      node_ = parent;
+      parent = parent->get_parent();
     }
+    node_ = parent;
   }
 
   return *this;
@@ -128,33 +128,51 @@ tree_node<V, K, T>::iterator::operator--() {
 template <class V, class K, class T>
 typename tree_node<V, K, T>::iterator &
 tree_node<V, K, T>::iterator::operator++() {
-  if (end_iterator_) {
-    end_iterator_ = false;
-    node_ = node_->back();
-  } else if (node_ == node_->back()) {
-    end_iterator_ = true;
-  } else if (node_->get_right() != nullptr) {
+  if (node_->get_right() != nullptr) {
     node_ = node_->get_right();
     while (node_->get_left()) {
       node_ = node_->get_left();
     }
   } else {
-    while (node_->get_parent() && node_->get_parent()->get_right() == node_) {
-      node_ = node_->get_parent();
+    tree_node *parent = node_->get_parent();
+    while (node_ == parent->get_right()) {
+      node_ = parent;
+      parent = parent->get_parent();
     }
-    if (node_->get_parent() && node_ == node_->get_parent()->get_left()) {
-      node_ = node_->get_parent();
+    // stepping from the rightmost node when it is the root leaves node_ on
+    // the header already
+    if (node_->get_right() != parent) {
+      node_ = parent;
     }
   }
 
   return *this;
 }
 
+// Skips whole right subtrees by their sizes: O(log n) instead of count
+// single steps
 template <class V, class K, class T>
 typename tree_node<V, K, T>::iterator &
 tree_node<V, K, T>::TreeIterator::operator+=(tree_node::size_type count) {
-  for (int i = 0; i < count; ++i) {
-    ++(*this);
+  while (count > 0 && !node_->is_header()) {
+    size_type right_size = subtree_size(node_->get_right());
+    if (count <= right_size) {
+      node_ = select(node_->get_right(), count - 1);
+      break;
+    }
+    count -= right_size + 1;
+
+    // climb to the first ancestor holding the subtree on its left
+    bool from_left = false;
+    while (!from_left) {
+      tree_node *parent = node_->get_parent();
+      if (parent->get_parent() == node_) {
+        node_ = parent;  // past the root: the header
+        break;
+      }
+      from_left = parent->get_left() == node_;
+      node_ = parent;
+    }
   }
 
   return *this;
@@ -163,8 +181,30 @@ tree_node<V, K, T>::TreeIterator::operator+=(tree_node::size_type count) {
 template <class V, class K, class T>
 typename tree_node<V, K, T>::iterator &
 tree_node<V, K, T>::TreeIterator::operator-=(tree_node::size_type count) {
-  for (int i = 0; i < count; ++i) {
-    --(*this);
+  if (count > 0 && node_->is_header()) {
+    node_ = node_->get_right();
+    --count;
+  }
+
+  while (count > 0 && !node_->is_header()) {
+    size_type left_size = subtree_size(node_->get_left());
+    if (count <= left_size) {
+      node_ = select(node_->get_left(), left_size - count);
+      break;
+    }
+    count -= left_size + 1;
+
+    // climb to the first ancestor holding the subtree on its right
+    bool from_right = false;
+    while (!from_right) {
+      tree_node *parent = node_->get_parent();
+      if (parent->get_parent() == node_) {
+        node_ = parent;
+        break;
+      }
+      from_right = parent->get_right() == node_;
+      node_ = parent;
+    }
   }
 
   return *this;
@@ -189,29 +229,18 @@ tree_node<V, K, T>::TreeIterator::operator+(tree_node::size_type count) {
 template <class V, class K, class T>
 bool tree_node<V, K, T>::iterator::operator==(
     const iterator &other) const noexcept {
-  if (end_iterator_ == other.end_iterator_ && end_iterator_ == true) {
-    return true;
-  }
-  return node_ == other.node_ && end_iterator_ == other.end_iterator_;
+  return node_ == other.node_;
 }
 
 template <class V, class K, class T>
 bool tree_node<V, K, T>::iterator::operator!=(
     const iterator &other) const noexcept {
-  if (end_iterator_ == other.end_iterator_ && end_iterator_ == false) {
-    return false;
-  }
-  return node_ != other.node_ || end_iterator_ != other.end_iterator_;
+  return node_ != other.node_;
 }
 
-template <class V, class K, class T>
-tree_node<V, K, T>::TreeIterator::TreeIterator(tree_node *node,
-                                               bool end_iterator) noexcept
-    : node_(node), end_iterator_(end_iterator) {}
-
 template <class V, class K, class T>
 tree_node<V, K, T>::TreeIterator::TreeIterator(tree_node *node) noexcept
-    : node_(node), end_iterator_(node == nullptr) {}
+    : node_(node) {}
 
 template <class V, class K, class T>
 tree_node<V, K, T> *tree_node<V, K, T>::TreeIterator::get_node()
@@ -220,214 +249,98 @@ tree_node<V, K, T> *tree_node<V, K, T>::TreeIterator::get_node()
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T>::tree_node(value_type value) noexcept : value_(value) {}
+tree_node<V, K, T>::tree_node(value_type value) noexcept
+    : value_(std::move(value)) {}
 
 template <class V, class K, class T>
 tree_node<V, K, T>::tree_node(value_type value, tree_node *parent) noexcept
-    : value_(value), parent_(parent) {}
+    : value_(std::move(value)), parent_(parent) {}
 
 template <class V, class K, class T>
-tree_node<V, K, T>::tree_node(const tree_node &other) {
-  *this = other;
-}
-
-template <class V, class K, class T>
-tree_node<V, K, T> &tree_node<V, K, T>::operator=(
-    const tree_node<V, K, T> &other) {
-  if (this == &other) {
-    return *this;
-  }
-
-  clear();
-
-  value_ = other.value_;
-  if (!left_ && other.left_) {
-    left_ = new tree_node<V, K, T>;
-  }
-  left_ = other.left_;
-  left_->parent_ = this;
-
-  if (!right_ && other.right_) {
-    right_ = new tree_node<V, K, T>;
-  }
-  right_ = other.right_;
-  right_->parent_ = this;
-
-  return *this;
+tree_node<V, K, T> *tree_node<V, K, T>::get_left() const noexcept {
+  return left_;
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T>::~tree_node() noexcept {
-  delete right_;
-  delete left_;
+tree_node<V, K, T> *tree_node<V, K, T>::get_right() const noexcept {
+  return right_;
 }
 
 template <class V, class K, class T>
-[[nodiscard]] typename tree_node<V, K, T>::size_type tree_node<V, K, T>::size()
-    const noexcept {
-  size_type result = 1;
-  if (left_) {
-    result += left_->size();
-  }
-  if (right_) {
-    result += right_->size();
-  }
-  return result;
+tree_node<V, K, T> *tree_node<V, K, T>::get_parent() const noexcept {
+  return parent_;
 }
 
 template <class V, class K, class T>
-void tree_node<V, K, T>::clear() noexcept {
-  if (left_) {
-    left_->clear();
-  }
-  if (right_) {
-    right_->clear();
-  }
-  delete this;
+node_color tree_node<V, K, T>::get_color() const noexcept {
+  return color_;
 }
 
 template <class V, class K, class T>
-typename tree_node<V, K, T>::iterator tree_node<V, K, T>::insert(
-    const value_type &value) {
-  if (value_.key() <= value.key()) {
-    if (!right_) {
-      right_ = new tree_node<V, K, T>(value, this);
-      return iterator(right_);
-    } else {
-      return right_->insert(value);
-    }
-  }
-
-  if (!left_) {
-    left_ = new tree_node<V, K, T>(value, this);
-    return iterator(left_);
-  } else {
-    return left_->insert(value);
-  }
+typename tree_node<V, K, T>::size_type tree_node<V, K, T>::get_size()
+    const noexcept {
+  return size_;
 }
 
 template <class V, class K, class T>
-void tree_node<V, K, T>::erase(iterator pos) {
-  if (!pos.get_node()->left_ && !pos.get_node()->right_) {
-    if (pos.get_node()->parent_) {
-      if (pos.get_node()->parent_->right_ == pos.get_node()) {
-        pos.get_node()->parent_->right_ = nullptr;
-      } else {
-        pos.get_node()->parent_->left_ = nullptr;
-      }
-    }
-    delete pos.get_node();
-  } else if (!pos.get_node()->left_) {
-    tree_node *swap_with = pos.get_node()->right_;
-    pos.get_node()->left_ = swap_with->left_;
-    pos.get_node()->right_ = swap_with->right_;
-    if (pos.get_node()->left_) {
-      pos.get_node()->left_->parent_ = pos.get_node();
-    }
-    if (pos.get_node()->right_) {
-      pos.get_node()->right_->parent_ = pos.get_node();
-    }
-    pos.get_node()->value_ = swap_with->get_value();
-    swap_with->left_ = swap_with->right_ = nullptr;
-    delete swap_with;
-  } else if (!pos.get_node()->right_) {
-    tree_node *swap_with = pos.get_node()->left_;
-    pos.get_node()->left_ = swap_with->left_;
-    pos.get_node()->right_ = swap_with->right_;
-    if (pos.get_node()->left_) {
-      pos.get_node()->left_->parent_ = pos.get_node();
-    }
-    if (pos.get_node()->right_) {
-      pos.get_node()->right_->parent_ = pos.get_node();
-    }
-    pos.get_node()->value_ = swap_with->get_value();
-    swap_with->left_ = swap_with->right_ = nullptr;
-    delete swap_with;
-  } else {
-    if (!pos.get_node()->right_->left_) {
-      tree_node *swap_with = pos.get_node()->right_;
-      if (swap_with->right_) {
-        swap_with->right_->parent_ = pos.get_node();
-      }
-      pos.get_node()->value_ = swap_with->value_;
-      pos.get_node()->right_ = swap_with->right_;
-      delete swap_with;
-    } else {
-      tree_node *leftest = pos.get_node()->right_->left_;
-      while (leftest->left_) {
-        leftest = leftest->left_;
-      }
-      pos.get_node()->value_ = leftest->value_;
-      erase(iterator(leftest));
-    }
-  }
+typename tree_node<V, K, T>::value_type &
+tree_node<V, K, T>::get_value() noexcept {
+  return value_;
 }
 
 template <class V, class K, class T>
-typename tree_node<V, K, T>::iterator tree_node<V, K, T>::find(
-    const key_type &key) noexcept {
-  iterator found = find_place(key);
-  if (found.get_node()->value_.key() != key) {
-    return nullptr;
-  }
-
-  return found;
+void tree_node<V, K, T>::set_left(tree_node *node) noexcept {
+  left_ = node;
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T> *tree_node<V, K, T>::get_left() const noexcept {
-  return left_;
+void tree_node<V, K, T>::set_right(tree_node *node) noexcept {
+  right_ = node;
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T> *tree_node<V, K, T>::get_right() const noexcept {
-  return right_;
+void tree_node<V, K, T>::set_parent(tree_node *node) noexcept {
+  parent_ = node;
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T> *tree_node<V, K, T>::get_parent() const noexcept {
-  return parent_;
+void tree_node<V, K, T>::set_color(node_color color) noexcept {
+  color_ = color;
 }
 
 template <class V, class K, class T>
-typename tree_node<V, K, T>::value_type &
-tree_node<V, K, T>::get_value() noexcept {
-  return value_;
+void tree_node<V, K, T>::set_size(size_type size) noexcept {
+  size_ = size;
 }
 
+// The header is the only red node whose grandparent is itself: the root is
+// always black
 template <class V, class K, class T>
-tree_node<V, K, T> *tree_node<V, K, T>::front() noexcept {
-  if (parent_) {
-    return parent_->front();
-  }
-  tree_node *pointer = this;
-  while (pointer->left_) {
-    pointer = pointer->left_;
-  }
-  return pointer;
+bool tree_node<V, K, T>::is_header() const noexcept {
+  return color_ == node_color::kRed && parent_ != nullptr &&
+         parent_->parent_ == this;
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T> *tree_node<V, K, T>::back() noexcept {
-  if (parent_) {
-    return parent_->back();
-  }
-  tree_node *pointer = this;
-  while (pointer->right_) {
-    pointer = pointer->right_;
-  }
-  return pointer;
+typename tree_node<V, K, T>::size_type tree_node<V, K, T>::subtree_size(
+    const tree_node *node) noexcept {
+  return node == nullptr ? 0 : node->size_;
 }
 
 template <class V, class K, class T>
-tree_node<V, K, T> *tree_node<V, K, T>::find_place(
-    const key_type &key) noexcept {
-  if (value_.key() < key && right_ != nullptr) {
-    return right_->find_place(key);
-  } else if (value_.key() > key && left_ != nullptr) {
-    return left_->find_place(key);
+tree_node<V, K, T> *tree_node<V, K, T>::select(tree_node *node,
+                                               size_type k) noexcept {
+  while (true) {
+    size_type left_size = subtree_size(node->left_);
+    if (k < left_size) {
+      node = node->left_;
+    } else if (k == left_size) {
+      return node;
+    } else {
+      k -= left_size + 1;
+      node = node->right_;
+    }
   }
-  return this;
 }
 
 }  // namespace s21
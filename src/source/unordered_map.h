@@ -0,0 +1,268 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_UNORDERED_MAP_H_
+#define SRC_SOURCE_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+#include "container.h"
+#include "hash_table.h"
+
+namespace s21 {
+
+// map interface over a Swiss table: point lookups probe 16 control bytes
+// at once instead of walking a tree. Iteration order is unspecified, an
+// insert may rehash and invalidate all iterators
+template <class K, class T, class Hash = std::hash<K>,
+          class KeyEqual = std::equal_to<K>>
+class unordered_map : public container<T> {
+ private:
+  struct KeyOfValue;
+  using table_type =
+      hash_table<std::pair<K, T>, K, KeyOfValue, Hash, KeyEqual>;
+
+ public:
+  using key_type = K;
+  using mapped_type = T;
+  using value_type = std::pair<K, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using size_type = size_t;
+
+  unordered_map() noexcept = default;
+  unordered_map(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  unordered_map(InputIt first, InputIt last);
+  unordered_map(const unordered_map &m);
+  unordered_map(unordered_map &&m) noexcept;
+
+  ~unordered_map() noexcept = default;
+
+  unordered_map &operator=(const unordered_map &m);
+  unordered_map &operator=(unordered_map &&m) noexcept;
+
+  mapped_type &at(const key_type &key);
+  mapped_type &operator[](const key_type &key);
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  size_type max_size() const noexcept;
+  // Number of slots, at most 7/8 of them are used
+  size_type bucket_count() const noexcept;
+  void reserve(size_type count);
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+  void erase(iterator pos);
+  void swap(unordered_map &other);
+  void merge(unordered_map &other);
+
+  iterator find(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  [[nodiscard]] size_type count(const key_type &key) const;
+
+ private:
+  struct KeyOfValue {
+    static const key_type &key(const value_type &value) noexcept;
+  };
+
+  table_type table_ = table_type();
+};
+
+template <class K, class T, class Hash, class KeyEqual>
+unordered_map<K, T, Hash, KeyEqual>::unordered_map(
+    const std::initializer_list<value_type> &items) {
+  table_.reserve(items.size());
+  for (const auto &elem : items) {
+    insert(elem);
+  }
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+template <class InputIt>
+unordered_map<K, T, Hash, KeyEqual>::unordered_map(InputIt first,
+                                                   InputIt last) {
+  for (; first != last; ++first) {
+    insert(*first);
+  }
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+unordered_map<K, T, Hash, KeyEqual>::unordered_map(const unordered_map &m) {
+  *this = m;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+unordered_map<K, T, Hash, KeyEqual>::unordered_map(unordered_map &&m) noexcept {
+  *this = std::move(m);
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+unordered_map<K, T, Hash, KeyEqual> &
+unordered_map<K, T, Hash, KeyEqual>::operator=(const unordered_map &m) {
+  table_ = m.table_;
+  return *this;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+unordered_map<K, T, Hash, KeyEqual> &
+unordered_map<K, T, Hash, KeyEqual>::operator=(unordered_map &&m) noexcept {
+  table_ = std::move(m.table_);
+  return *this;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::mapped_type &
+unordered_map<K, T, Hash, KeyEqual>::at(const key_type &key) {
+  iterator found = table_.find(key);
+  if (found == end()) {
+    throw std::out_of_range(
+        "Container does not have an element with the specified key");
+  }
+  return (*found).second;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::mapped_type &
+unordered_map<K, T, Hash, KeyEqual>::operator[](const key_type &key) {
+  // the mapped value is constructed only if key is absent
+  std::pair<iterator, bool> result = table_.try_emplace(
+      key, std::piecewise_construct, std::forward_as_tuple(key),
+      std::tuple<>());
+  return (*result.first).second;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::iterator
+unordered_map<K, T, Hash, KeyEqual>::begin() const noexcept {
+  return table_.begin();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::iterator
+unordered_map<K, T, Hash, KeyEqual>::end() const noexcept {
+  return table_.end();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+bool unordered_map<K, T, Hash, KeyEqual>::empty() const noexcept {
+  return table_.empty();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::size_type
+unordered_map<K, T, Hash, KeyEqual>::size() const noexcept {
+  return table_.size();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::size_type
+unordered_map<K, T, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::size_type
+unordered_map<K, T, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+void unordered_map<K, T, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+void unordered_map<K, T, Hash, KeyEqual>::clear() noexcept {
+  table_.clear();
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = table_.try_emplace(value.first, value);
+  if (!result.second) {
+    result.first = table_.end();
+  }
+  return result;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert(const key_type &key,
+                                            const mapped_type &obj) {
+  std::pair<iterator, bool> result = table_.try_emplace(key, key, obj);
+  if (!result.second) {
+    result.first = table_.end();
+  }
+  return result;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+std::pair<typename unordered_map<K, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<K, T, Hash, KeyEqual>::insert_or_assign(const key_type &key,
+                                                      const mapped_type &obj) {
+  std::pair<iterator, bool> result = table_.try_emplace(key, key, obj);
+  if (!result.second) {
+    (*result.first).second = obj;
+  }
+  return result;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+void unordered_map<K, T, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase(pos);
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+void unordered_map<K, T, Hash, KeyEqual>::swap(unordered_map &other) {
+  table_.swap(other.table_);
+}
+
+// Values with keys absent here are moved from other, the rest stay there
+template <class K, class T, class Hash, class KeyEqual>
+void unordered_map<K, T, Hash, KeyEqual>::merge(unordered_map &other) {
+  table_.merge_unique(other.table_);
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::iterator
+unordered_map<K, T, Hash, KeyEqual>::find(const key_type &key) const {
+  return table_.find(key);
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+bool unordered_map<K, T, Hash, KeyEqual>::contains(const key_type &key) const {
+  return table_.contains(key);
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+typename unordered_map<K, T, Hash, KeyEqual>::size_type
+unordered_map<K, T, Hash, KeyEqual>::count(const key_type &key) const {
+  return table_.contains(key) ? 1 : 0;
+}
+
+template <class K, class T, class Hash, class KeyEqual>
+const typename unordered_map<K, T, Hash, KeyEqual>::key_type &
+unordered_map<K, T, Hash, KeyEqual>::KeyOfValue::key(
+    const value_type &value) noexcept {
+  return value.first;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_UNORDERED_MAP_H_
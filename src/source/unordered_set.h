@@ -0,0 +1,213 @@
+// Copyright 2023 school-21
+
+#ifndef SRC_SOURCE_UNORDERED_SET_H_
+#define SRC_SOURCE_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "container.h"
+#include "hash_table.h"
+
+namespace s21 {
+
+// set interface over a Swiss table: point lookups probe 16 control bytes
+// at once instead of walking a tree. Iteration order is unspecified, an
+// insert may rehash and invalidate all iterators
+template <class V, class Hash = std::hash<V>, class KeyEqual = std::equal_to<V>>
+class unordered_set : public container<V> {
+ private:
+  struct KeyOfValue;
+  using table_type = hash_table<V, V, KeyOfValue, Hash, KeyEqual>;
+
+ public:
+  using value_type = V;
+  using key_type = V;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+  using reference = V &;
+  using const_reference = const V &;
+  using size_type = size_t;
+
+  unordered_set() noexcept = default;
+  unordered_set(std::initializer_list<value_type> const &items);
+  template <class InputIt>
+  unordered_set(InputIt first, InputIt last);
+  unordered_set(const unordered_set &other);
+  unordered_set(unordered_set &&other) noexcept;
+  unordered_set &operator=(const unordered_set &other);
+  unordered_set &operator=(unordered_set &&other) noexcept;
+
+  ~unordered_set() noexcept = default;
+
+  iterator begin() const noexcept;
+  iterator end() const noexcept;
+
+  [[nodiscard]] bool empty() const noexcept override;
+  [[nodiscard]] size_type size() const noexcept override;
+  [[nodiscard]] size_type max_size() const noexcept;
+  // Number of slots, at most 7/8 of them are used
+  [[nodiscard]] size_type bucket_count() const noexcept;
+  void reserve(size_type count);
+
+  void clear() noexcept;
+  std::pair<iterator, bool> insert(const value_type &value);
+  void erase(iterator pos);
+  void swap(unordered_set &other) noexcept;
+  void merge(unordered_set &other);
+
+  iterator find(const key_type &key) const;
+  [[nodiscard]] bool contains(const key_type &key) const;
+  [[nodiscard]] size_type count(const key_type &key) const;
+
+ private:
+  struct KeyOfValue {
+    static const key_type &key(const value_type &value) noexcept;
+  };
+
+  table_type table_ = table_type();
+};
+
+template <class V, class Hash, class KeyEqual>
+unordered_set<V, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> const &items) {
+  table_.reserve(items.size());
+  for (const auto &elem : items) {
+    insert(elem);
+  }
+}
+
+template <class V, class Hash, class KeyEqual>
+template <class InputIt>
+unordered_set<V, Hash, KeyEqual>::unordered_set(InputIt first, InputIt last) {
+  for (; first != last; ++first) {
+    insert(*first);
+  }
+}
+
+template <class V, class Hash, class KeyEqual>
+unordered_set<V, Hash, KeyEqual>::unordered_set(const unordered_set &other) {
+  *this = other;
+}
+
+template <class V, class Hash, class KeyEqual>
+unordered_set<V, Hash, KeyEqual>::unordered_set(
+    unordered_set &&other) noexcept {
+  *this = std::move(other);
+}
+
+template <class V, class Hash, class KeyEqual>
+unordered_set<V, Hash, KeyEqual> &unordered_set<V, Hash, KeyEqual>::operator=(
+    const unordered_set &other) {
+  table_ = other.table_;
+  return *this;
+}
+
+template <class V, class Hash, class KeyEqual>
+unordered_set<V, Hash, KeyEqual> &unordered_set<V, Hash, KeyEqual>::operator=(
+    unordered_set &&other) noexcept {
+  table_ = std::move(other.table_);
+  return *this;
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::iterator
+unordered_set<V, Hash, KeyEqual>::begin() const noexcept {
+  return table_.begin();
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::iterator
+unordered_set<V, Hash, KeyEqual>::end() const noexcept {
+  return table_.end();
+}
+
+template <class V, class Hash, class KeyEqual>
+bool unordered_set<V, Hash, KeyEqual>::empty() const noexcept {
+  return table_.empty();
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::size_type
+unordered_set<V, Hash, KeyEqual>::size() const noexcept {
+  return table_.size();
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::size_type
+unordered_set<V, Hash, KeyEqual>::max_size() const noexcept {
+  return table_.max_size();
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::size_type
+unordered_set<V, Hash, KeyEqual>::bucket_count() const noexcept {
+  return table_.capacity();
+}
+
+template <class V, class Hash, class KeyEqual>
+void unordered_set<V, Hash, KeyEqual>::reserve(size_type count) {
+  table_.reserve(count);
+}
+
+template <class V, class Hash, class KeyEqual>
+void unordered_set<V, Hash, KeyEqual>::clear() noexcept {
+  table_.clear();
+}
+
+template <class V, class Hash, class KeyEqual>
+std::pair<typename unordered_set<V, Hash, KeyEqual>::iterator, bool>
+unordered_set<V, Hash, KeyEqual>::insert(const value_type &value) {
+  std::pair<iterator, bool> result = table_.try_emplace(value, value);
+  if (!result.second) {
+    result.first = table_.end();
+  }
+  return result;
+}
+
+template <class V, class Hash, class KeyEqual>
+void unordered_set<V, Hash, KeyEqual>::erase(iterator pos) {
+  table_.erase(pos);
+}
+
+template <class V, class Hash, class KeyEqual>
+void unordered_set<V, Hash, KeyEqual>::swap(unordered_set &other) noexcept {
+  table_.swap(other.table_);
+}
+
+// Values absent here are moved from other, the rest stay there
+template <class V, class Hash, class KeyEqual>
+void unordered_set<V, Hash, KeyEqual>::merge(unordered_set &other) {
+  table_.merge_unique(other.table_);
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::iterator
+unordered_set<V, Hash, KeyEqual>::find(const key_type &key) const {
+  return table_.find(key);
+}
+
+template <class V, class Hash, class KeyEqual>
+bool unordered_set<V, Hash, KeyEqual>::contains(const key_type &key) const {
+  return table_.contains(key);
+}
+
+template <class V, class Hash, class KeyEqual>
+typename unordered_set<V, Hash, KeyEqual>::size_type
+unordered_set<V, Hash, KeyEqual>::count(const key_type &key) const {
+  return table_.contains(key) ? 1 : 0;
+}
+
+template <class V, class Hash, class KeyEqual>
+const typename unordered_set<V, Hash, KeyEqual>::key_type &
+unordered_set<V, Hash, KeyEqual>::KeyOfValue::key(
+    const value_type &value) noexcept {
+  return value;
+}
+
+}  // namespace s21
+
+#endif  // SRC_SOURCE_UNORDERED_SET_H_
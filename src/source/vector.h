@@ -5,14 +5,40 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
 #include "container.h"
 
 namespace s21 {
 
+// A type whose objects may be moved to another address by copying their
+// bytes, with nothing left to destroy at the old one. True for trivially
+// copyable types; others opt in with a specialization, e.g.
+// template <> struct s21::is_trivially_relocatable<X> : std::true_type {};
+template <class T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+// Iterators that may be walked twice, so a range can be measured first
+template <class It, class = void>
+struct is_forward_iterator : std::false_type {};
+
+template <class It>
+struct is_forward_iterator<
+    It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<It>::iterator_category> {};
+
 template <class T>
 class vector : public container<T> {
  public:
@@ -56,8 +82,32 @@ class vector : public container<T> {
   // Vector Modifiers
   void clear() noexcept;
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  // pos may be end(). The value is constructed from args, before another
+  // element it takes one move
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  // Each argument makes one element in place, they keep the argument order
+  // before pos, which may be end(). Grows at most once and returns the
+  // iterator to the first inserted element. If building one throws, the
+  // vector is left unchanged
+  template <class... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <class... Args>
+  void insert_many_back(Args &&...args);
+  // Range and count inserts take pos up to end(). The storage grows at most
+  // once and the new elements are rotated into place in one pass
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <class InputIt,
+            class = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
   void erase(iterator pos);
+  // The tail is moved down once, returns the iterator after the erased
+  iterator erase(const_iterator first, const_iterator last);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+  template <class... Args>
+  reference emplace_back(Args &&...args);
   void pop_back();
   void swap(vector &other) noexcept;
 
@@ -71,102 +121,200 @@ class vector : public container<T> {
   static constexpr size_type kMaxSize = size_type(-1) / sizeof(value_type);
 
   // Helpers
-  void allocate_memory(const size_type n);
-  void resize(const size_type n);
+  // Raw storage: slots in [size_, capacity_) hold no objects
+  static value_type *allocate_memory(const size_type n);
+  static void deallocate_memory(value_type *memory, const size_type n) noexcept;
   void recap(const size_type n);
+  // Moves the elements into memory of n slots and frees the old block. On
+  // a throw memory is left to the caller and *this is unchanged
+  void relocate(value_type *memory, const size_type n);
+  // Room for count more elements, growing as push_back does
+  void grow_for(const size_type count);
+  // Grows the storage and constructs the new last element from args
+  template <class... Args>
+  void grow_append(Args &&...args);
+  // Constructs one element from each argument at the end, growing at most
+  // once. On a throw *this is unchanged
+  template <class... Args>
+  void append_each(Args &&...args);
+  // Copy constructs [first, last) into raw memory, one memcpy for
+  // trivially copyable types
+  static void copy_into(const value_type *first, const value_type *last,
+                        value_type *memory);
   [[nodiscard]] size_type calculate_capacity(
       const size_type size) const noexcept;
-  void shift_left(const size_type shift_after, const size_type shift_on);
-  void shift_right(const size_type shift_after, const size_type shift_on);
 };
 
 // Helpers
 template <class T>
-void vector<T>::allocate_memory(const size_type n) {
-  delete[] memory_;
+typename vector<T>::value_type *vector<T>::allocate_memory(const size_type n) {
+  if (n == 0) {
+    return nullptr;
+  }
 
-  if (n != 0) {
-    try {
-      memory_ = new value_type[n];
-    } catch (const std::bad_alloc &exc) {
-      throw std::out_of_range("Alloc error in allocate_memory");
-    }
+  try {
+    return std::allocator<value_type>().allocate(n);
+  } catch (const std::bad_alloc &exc) {
+    throw std::out_of_range("Alloc error in allocate_memory");
   }
+}
 
-  capacity_ = n;
+template <class T>
+void vector<T>::deallocate_memory(value_type *memory,
+                                  const size_type n) noexcept {
+  if (memory != nullptr) {
+    std::allocator<value_type>().deallocate(memory, n);
+  }
 }
 
 template <class T>
-void vector<T>::resize(const size_type n) {
-  if (n <= capacity_) {
-    size_ = n;
-    return;
+void vector<T>::recap(const size_type n) {
+  value_type *memory = allocate_memory(n);
+  try {
+    relocate(memory, n);
+  } catch (...) {
+    deallocate_memory(memory, n);
+    throw;
   }
+}
 
-  if (empty()) {
-    *this = vector(n);
-    return;
+// Relocatable elements are moved as bytes and the old ones are not
+// destroyed. Otherwise as std::move_if_noexcept: elements whose move may
+// throw are copied, so a throw leaves the old block intact
+template <class T>
+void vector<T>::relocate(value_type *memory, const size_type n) {
+  if constexpr (is_trivially_relocatable_v<value_type>) {
+    if (size_ != 0) {
+      std::memcpy(static_cast<void *>(memory), memory_,
+                  size_ * sizeof(value_type));
+    }
+  } else {
+    if constexpr (std::is_nothrow_move_constructible_v<value_type> ||
+                  !std::is_copy_constructible_v<value_type>) {
+      std::uninitialized_move(begin(), end(), memory);
+    } else {
+      std::uninitialized_copy(begin(), end(), memory);
+    }
+    std::destroy(begin(), end());
   }
 
-  recap(calculate_capacity(n));
-  size_ = n;
+  deallocate_memory(memory_, capacity_);
+  memory_ = memory;
+  capacity_ = n;
 }
 
 template <class T>
-void vector<T>::recap(const size_type n) {
-  vector<value_type> copy(*this);
-  allocate_memory(n);
-  std::copy(copy.begin(), copy.begin() + std::min(copy.size_, n), begin());
+void vector<T>::grow_for(const size_type count) {
+  if (size_ + count > capacity_) {
+    recap(calculate_capacity(size_ + count));
+  }
 }
 
+// The new element is built first: args may refer to an element of the old
+// block
 template <class T>
-typename vector<T>::size_type vector<T>::calculate_capacity(
-    const size_type size) const noexcept {
-  size_type res = std::max(capacity_, size_type(1));
-  while (res < size) {
-    res *= 2;
+template <class... Args>
+void vector<T>::grow_append(Args &&...args) {
+  size_type n = calculate_capacity(size_ + 1);
+  value_type *memory = allocate_memory(n);
+  try {
+    new (memory + size_) value_type(std::forward<Args>(args)...);
+  } catch (...) {
+    deallocate_memory(memory, n);
+    throw;
   }
 
-  return res;
+  try {
+    relocate(memory, n);
+  } catch (...) {
+    std::destroy_at(memory + size_);
+    deallocate_memory(memory, n);
+    throw;
+  }
+  ++size_;
 }
 
+// As in grow_append the new elements go to the new block first, args may
+// refer to elements of the old one
 template <class T>
-void vector<T>::shift_right(const size_type shift_after,
-                            const size_type shift_on) {
-  resize(size_ + shift_on);
-  for (size_type i = size_ - 1; i >= shift_after + shift_on; --i) {
-    memory_[i] = memory_[i - shift_on];
+template <class... Args>
+void vector<T>::append_each(Args &&...args) {
+  constexpr size_type count = sizeof...(Args);
+  if (size_ + count <= capacity_) {
+    size_type old_size = size_;
+    try {
+      ((new (memory_ + size_) value_type(std::forward<Args>(args)), ++size_),
+       ...);
+    } catch (...) {
+      std::destroy(memory_ + old_size, memory_ + size_);
+      size_ = old_size;
+      throw;
+    }
+    return;
   }
-  for (size_type i = shift_after + shift_on - 1; i > shift_after; --i) {
-    memory_[i] = value_type();
+
+  size_type n = calculate_capacity(size_ + count);
+  value_type *memory = allocate_memory(n);
+  value_type *tail = memory + size_;
+  size_type built = 0;
+  try {
+    ((new (tail + built) value_type(std::forward<Args>(args)), ++built), ...);
+    relocate(memory, n);
+  } catch (...) {
+    std::destroy(tail, tail + built);
+    deallocate_memory(memory, n);
+    throw;
   }
+  size_ += count;
 }
 
 template <class T>
-void vector<T>::shift_left(const size_type shift_after,
-                           const size_type shift_on) {
-  if (size_ < shift_on + shift_after) {
-    throw std::out_of_range("Shift left on too big value");
+void vector<T>::copy_into(const value_type *first, const value_type *last,
+                          value_type *memory) {
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    if (first != last) {
+      std::memcpy(static_cast<void *>(memory), first,
+                  size_type(last - first) * sizeof(value_type));
+    }
+  } else {
+    std::uninitialized_copy(first, last, memory);
   }
+}
 
-  for (size_type i = shift_after; i < size_ - shift_on; ++i) {
-    memory_[i] = memory_[i + shift_on];
+template <class T>
+typename vector<T>::size_type vector<T>::calculate_capacity(
+    const size_type size) const noexcept {
+  size_type res = std::max(capacity_, size_type(1));
+  while (res < size) {
+    res *= 2;
   }
-  resize(size_ - shift_on);
+
+  return res;
 }
 
 // Vector Member type
 template <class T>
-vector<T>::vector(const size_type n) : size_(n) {
-  allocate_memory(n);
-  std::fill(begin(), end(), value_type());
+vector<T>::vector(const size_type n)
+    : memory_(allocate_memory(n)), capacity_(n) {
+  try {
+    std::uninitialized_value_construct_n(memory_, n);
+  } catch (...) {
+    deallocate_memory(memory_, capacity_);
+    throw;
+  }
+  size_ = n;
 }
 
 template <class T>
 vector<T>::vector(std::initializer_list<value_type> const &items)
-    : size_(items.size()) {
-  allocate_memory(items.size());
-  std::copy(items.begin(), items.end(), memory_);
+    : memory_(allocate_memory(items.size())), capacity_(items.size()) {
+  try {
+    copy_into(items.begin(), items.end(), memory_);
+  } catch (...) {
+    deallocate_memory(memory_, capacity_);
+    throw;
+  }
+  size_ = items.size();
 }
 
 template <class T>
@@ -175,9 +323,19 @@ vector<T> &vector<T>::operator=(const vector<T> &v) {
     return *this;
   }
 
-  allocate_memory(v.capacity_);
+  value_type *memory = allocate_memory(v.capacity_);
+  try {
+    copy_into(v.begin(), v.end(), memory);
+  } catch (...) {
+    deallocate_memory(memory, v.capacity_);
+    throw;
+  }
+
+  clear();
+  deallocate_memory(memory_, capacity_);
+  memory_ = memory;
   size_ = v.size_;
-  std::copy(v.begin(), v.end(), begin());
+  capacity_ = v.capacity_;
 
   return *this;
 }
@@ -193,7 +351,8 @@ vector<T> &vector<T>::operator=(vector<T> &&v) noexcept {
     return *this;
   }
 
-  delete[] memory_;
+  clear();
+  deallocate_memory(memory_, capacity_);
 
   memory_ = std::exchange(v.memory_, nullptr);
   size_ = std::exchange(v.size_, 0);
@@ -209,7 +368,8 @@ vector<T>::vector(vector &&v) noexcept {
 
 template <class T>
 vector<T>::~vector() noexcept {
-  delete[] memory_;
+  clear();
+  deallocate_memory(memory_, capacity_);
 }
 
 // Vector Element access
@@ -288,7 +448,9 @@ typename vector<T>::size_type vector<T>::max_size() const noexcept {
 
 template <class T>
 void vector<T>::shrink_to_fit() {
-  recap(size_);
+  if (size_ < capacity_) {
+    recap(size_);
+  }
 }
 
 template <class T>
@@ -301,6 +463,7 @@ void vector<T>::reserve(const size_type size) {
 // Vector Modifiers
 template <class T>
 void vector<T>::clear() noexcept {
+  std::destroy(begin(), end());
   size_ = 0;
 }
 
@@ -311,8 +474,24 @@ void vector<T>::swap(vector<T> &other) noexcept {
 
 template <class T>
 void vector<T>::push_back(const_reference value) {
-  resize(size_ + 1);
-  *(end() - 1) = value;
+  emplace_back(value);
+}
+
+template <class T>
+void vector<T>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class T>
+template <class... Args>
+typename vector<T>::reference vector<T>::emplace_back(Args &&...args) {
+  if (size_ == capacity_) {
+    grow_append(std::forward<Args>(args)...);
+  } else {
+    new (memory_ + size_) value_type(std::forward<Args>(args)...);
+    ++size_;
+  }
+  return memory_[size_ - 1];
 }
 
 template <class T>
@@ -320,18 +499,134 @@ void vector<T>::pop_back() {
   if (empty()) {
     throw std::out_of_range("Pop back of empty vector");
   }
-  resize(size_ - 1);
+  --size_;
+  std::destroy_at(memory_ + size_);
 }
 
 template <class T>
 typename vector<T>::iterator vector<T>::insert(iterator pos,
                                                const_reference value) {
+  return emplace(pos, value);
+}
+
+template <class T>
+typename vector<T>::iterator vector<T>::insert(iterator pos,
+                                               value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+// Relocatable elements after pos move one slot up as bytes. Otherwise the
+// last element is constructed one slot further and the others between pos
+// and it are shifted by assignment
+template <class T>
+template <class... Args>
+typename vector<T>::iterator vector<T>::emplace(const_iterator pos,
+                                                Args &&...args) {
   auto res_position = size_type(pos - begin());
-  if ((pos >= end() || pos < begin()) && !empty()) {
+  if (pos > end() || pos < begin()) {
     throw std::out_of_range("Bad insert place");
   }
-  shift_right(res_position, 1);
-  *(memory_ + res_position) = value;
+  if (pos == end()) {
+    emplace_back(std::forward<Args>(args)...);
+    return memory_ + res_position;
+  }
+
+  // args may refer to an element that is about to be shifted
+  value_type copy(std::forward<Args>(args)...);
+  if (size_ == capacity_) {
+    recap(calculate_capacity(size_ + 1));
+  }
+  if constexpr (is_trivially_relocatable_v<value_type>) {
+    value_type *slot = memory_ + res_position;
+    size_type tail_bytes = (size_ - res_position) * sizeof(value_type);
+    std::memmove(static_cast<void *>(slot + 1), slot, tail_bytes);
+    try {
+      new (slot) value_type(std::move(copy));
+    } catch (...) {
+      std::memmove(static_cast<void *>(slot), slot + 1, tail_bytes);
+      throw;
+    }
+    ++size_;
+    return slot;
+  }
+
+  new (memory_ + size_) value_type(std::move(memory_[size_ - 1]));
+  ++size_;
+  std::move_backward(memory_ + res_position, memory_ + size_ - 2,
+                     memory_ + size_ - 1);
+  memory_[res_position] = std::move(copy);
+  return memory_ + res_position;
+}
+
+// The new values are constructed at the end and rotated into place
+template <class T>
+template <class... Args>
+typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
+                                                    Args &&...args) {
+  auto res_position = size_type(pos - begin());
+  if (pos > end() || pos < begin()) {
+    throw std::out_of_range("Bad insert place");
+  }
+  size_type old_size = size_;
+  append_each(std::forward<Args>(args)...);
+  std::rotate(memory_ + res_position, memory_ + old_size, memory_ + size_);
+
+  return memory_ + res_position;
+}
+
+template <class T>
+template <class... Args>
+void vector<T>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+// value is copied first as it may be an element
+template <class T>
+typename vector<T>::iterator vector<T>::insert(const_iterator pos,
+                                               size_type count,
+                                               const_reference value) {
+  auto res_position = size_type(pos - begin());
+  if (pos > end() || pos < begin()) {
+    throw std::out_of_range("Bad insert place");
+  }
+  if (count != 0) {
+    value_type copy(value);
+    grow_for(count);
+    std::uninitialized_fill_n(memory_ + size_, count, copy);
+    size_ += count;
+    std::rotate(memory_ + res_position, memory_ + size_ - count,
+                memory_ + size_);
+  }
+
+  return memory_ + res_position;
+}
+
+// A single pass range is appended as it is read, on a throw the appended
+// elements are removed again
+template <class T>
+template <class InputIt, class>
+typename vector<T>::iterator vector<T>::insert(const_iterator pos,
+                                               InputIt first, InputIt last) {
+  auto res_position = size_type(pos - begin());
+  if (pos > end() || pos < begin()) {
+    throw std::out_of_range("Bad insert place");
+  }
+  if constexpr (is_forward_iterator<InputIt>::value) {
+    grow_for(size_type(std::distance(first, last)));
+  }
+
+  size_type old_size = size_;
+  try {
+    for (; first != last; ++first) {
+      emplace_back(*first);
+    }
+  } catch (...) {
+    std::destroy(memory_ + old_size, memory_ + size_);
+    size_ = old_size;
+    throw;
+  }
+  std::rotate(memory_ + res_position, memory_ + old_size, memory_ + size_);
+
   return memory_ + res_position;
 }
 
@@ -342,8 +637,51 @@ void vector<T>::erase(iterator pos) {
   } else if (pos >= end() || pos < begin()) {
     throw std::out_of_range("Bad erase place");
   }
-  auto res_position = size_type(pos - memory_);
-  shift_left(res_position, 1);
+  if constexpr (is_trivially_relocatable_v<value_type>) {
+    std::destroy_at(pos);
+    std::memmove(static_cast<void *>(pos), pos + 1,
+                 size_type(end() - pos - 1) * sizeof(value_type));
+    --size_;
+    return;
+  }
+
+  std::move(pos + 1, end(), pos);
+  pop_back();
+}
+
+template <class T>
+typename vector<T>::iterator vector<T>::erase(const_iterator first,
+                                              const_iterator last) {
+  if (first > last || first < begin() || last > end()) {
+    throw std::out_of_range("Bad erase place");
+  }
+  iterator from = begin() + (first - begin());
+  auto count = size_type(last - first);
+  if (count == 0) {
+    return from;
+  }
+  if constexpr (is_trivially_relocatable_v<value_type>) {
+    std::destroy(from, from + count);
+    std::memmove(static_cast<void *>(from), from + count,
+                 (size_type(end() - from) - count) * sizeof(value_type));
+  } else {
+    std::move(from + count, end(), from);
+    std::destroy(end() - count, end());
+  }
+  size_ -= count;
+
+  return from;
+}
+
+// Keeps the elements pred rejects in order with one pass and one erase,
+// returns how many were removed
+template <class T, class Pred>
+typename vector<T>::size_type erase_if(vector<T> &vec, Pred pred) {
+  auto kept_end = std::remove_if(vec.begin(), vec.end(), pred);
+  auto count = typename vector<T>::size_type(vec.end() - kept_end);
+  vec.erase(kept_end, vec.end());
+
+  return count;
 }
 
 }  // namespace s21
@@ -0,0 +1,136 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+TEST(BtreeMapSuite, access_test) {
+  btree_map<int, std::string> my_map = {{1, "one"}, {2, "two"}};
+  ASSERT_EQ(my_map.at(1), "one");
+  ASSERT_THROW(my_map.at(3), std::out_of_range);
+  my_map[3] = "three";
+  ASSERT_EQ(my_map.at(3), "three");
+  ASSERT_EQ(my_map[4], "");
+  ASSERT_EQ(my_map.size(), 4U);
+}
+
+TEST(BtreeMapSuite, insert_test) {
+  btree_map<int, int> my_map;
+  ASSERT_TRUE(my_map.insert(1, 10).second);
+  ASSERT_FALSE(my_map.insert({1, 20}).second);
+  ASSERT_EQ(my_map.at(1), 10);
+  ASSERT_FALSE(my_map.insert_or_assign(1, 30).second);
+  ASSERT_EQ(my_map.at(1), 30);
+
+  auto it = my_map.emplace_hint(my_map.end(), 2, 40);
+  ASSERT_EQ((*it).second, 40);
+  ASSERT_EQ((*my_map.insert(my_map.begin(), {2, 50})).second, 40);
+}
+
+TEST(BtreeMapSuite, erase_test) {
+  btree_map<int, std::string> my_map;
+  std::map<int, std::string> std_map;
+  for (int i = 0; i < 5000; ++i) {
+    my_map.insert(i * 31 % 5003, std::to_string(i));
+    std_map.insert({i * 31 % 5003, std::to_string(i)});
+  }
+  for (int i = 0; i < 5003; i += 2) {
+    auto found = my_map.find(i);
+    if (found != my_map.end()) {
+      my_map.erase(found);
+    }
+    std_map.erase(i);
+  }
+
+  ASSERT_EQ(my_map.size(), std_map.size());
+  auto my_it = my_map.begin();
+  for (const auto &elem : std_map) {
+    ASSERT_EQ((*my_it).first, elem.first);
+    ASSERT_EQ((*my_it).second, elem.second);
+    ++my_it;
+  }
+  ASSERT_TRUE(my_it == my_map.end());
+}
+
+TEST(BtreeMapSuite, erase_end_test) {
+  btree_map<int, int> my_map;
+  ASSERT_THROW(my_map.erase(my_map.end()), std::out_of_range);
+  my_map = {{1, 1}, {2, 2}, {3, 3}};
+  ASSERT_THROW(my_map.erase(my_map.end()), std::out_of_range);
+  ASSERT_EQ(my_map.size(), 3U);
+  ASSERT_TRUE(my_map.contains(3));
+}
+
+// Has no default constructor and counts the live objects
+struct live_value {
+  explicit live_value(int value) : value_(value) { ++alive; }
+  live_value(const live_value &other) : value_(other.value_) { ++alive; }
+  live_value &operator=(const live_value &other) = default;
+  ~live_value() { --alive; }
+
+  int value_;
+  static inline int alive = 0;
+};
+
+TEST(BtreeMapSuite, constructs_only_stored_values_test) {
+  {
+    btree_map<int, live_value> my_map;
+    for (int i = 0; i < 3000; ++i) {
+      my_map.insert(i * 7 % 3001, live_value(i));
+    }
+    ASSERT_EQ(live_value::alive, 3000);
+    for (int i = 0; i < 3001; i += 2) {
+      auto found = my_map.find(i);
+      if (found != my_map.end()) {
+        my_map.erase(found);
+      }
+    }
+    ASSERT_EQ(live_value::alive, int(my_map.size()));
+    btree_map<int, live_value> copy(my_map);
+    ASSERT_EQ(live_value::alive, 2 * int(my_map.size()));
+  }
+  ASSERT_EQ(live_value::alive, 0);
+}
+
+TEST(BtreeMapSuite, copy_move_swap_test) {
+  btree_map<int, int> my_map;
+  for (int i = 0; i < 1000; ++i) {
+    my_map[i] = i * 2;
+  }
+  btree_map<int, int> my_copy(my_map);
+  my_copy[0] = -1;
+  btree_map<int, int> my_moved = std::move(my_map);
+  ASSERT_EQ(my_moved.at(0), 0);
+  ASSERT_EQ(my_copy.at(0), -1);
+  ASSERT_EQ((*my_copy.upper_bound(500)).second, 1002);
+
+  btree_map<int, int> other = {{5, 5}};
+  other.swap(my_copy);
+  ASSERT_EQ(other.size(), 1000U);
+  ASSERT_EQ(my_copy.size(), 1U);
+}
+
+// Counts default constructions
+struct btree_map_defaulted {
+  btree_map_defaulted() { ++made; }
+
+  int value_ = 0;
+  static inline int made = 0;
+};
+
+TEST(BtreeMapSuite, subscript_hit_constructs_nothing_test) {
+  btree_map<int, btree_map_defaulted> my_map;
+  my_map[1].value_ = 5;
+  int made = btree_map_defaulted::made;
+  ASSERT_EQ(my_map[1].value_, 5);
+  ASSERT_EQ(btree_map_defaulted::made, made);
+  ASSERT_EQ(my_map.size(), 1U);
+}
+
+}  // namespace s21
@@ -0,0 +1,155 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <class T, class Compare>
+bool btree_sets_equal(const btree_set<T, Compare> &first,
+                      const std::set<T, Compare> &second) {
+  if (first.size() != second.size()) {
+    return false;
+  }
+  auto first_it = first.begin();
+  auto second_it = second.begin();
+  for (; first_it != first.end() && second_it != second.end();
+       ++first_it, ++second_it) {
+    if (*first_it != *second_it) {
+      return false;
+    }
+  }
+
+  return first_it == first.end() && second_it == second.end();
+}
+
+TEST(BtreeSetSuite, empty_test) {
+  btree_set<int> my_set;
+  ASSERT_TRUE(my_set.empty());
+  ASSERT_EQ(my_set.size(), 0U);
+  ASSERT_TRUE(my_set.begin() == my_set.end());
+  ASSERT_TRUE(my_set.find(1) == my_set.end());
+  ASSERT_THROW(my_set.erase(my_set.end()), std::out_of_range);
+
+  my_set.insert(1);
+  ASSERT_THROW(my_set.erase(my_set.end()), std::out_of_range);
+  ASSERT_EQ(my_set.size(), 1U);
+}
+
+TEST(BtreeSetSuite, insert_test) {
+  btree_set<int> my_set = {5, 1, 4, 1, 3};
+  ASSERT_TRUE(btree_sets_equal(my_set, std::set<int>{1, 3, 4, 5}));
+  ASSERT_EQ(*my_set.insert(2).first, 2);
+  ASSERT_FALSE(my_set.insert(2).second);
+  ASSERT_TRUE(my_set.insert(2).first == my_set.end());
+  ASSERT_EQ(my_set.size(), 5U);
+}
+
+// Enough keys for a tree of several levels: splits on the way up, borrows
+// and merges on the way down
+TEST(BtreeSetSuite, insert_erase_many_test) {
+  btree_set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 20000; ++i) {
+    my_set.insert(i * 7919 % 20011);
+    std_set.insert(i * 7919 % 20011);
+  }
+  ASSERT_TRUE(btree_sets_equal(my_set, std_set));
+
+  for (int i = 0; i < 20000; i += 3) {
+    auto found = my_set.find(i * 104729 % 20011);
+    if (found != my_set.end()) {
+      my_set.erase(found);
+    }
+    std_set.erase(i * 104729 % 20011);
+  }
+  ASSERT_TRUE(btree_sets_equal(my_set, std_set));
+
+  auto my_it = my_set.end();
+  for (auto std_it = std_set.rbegin(); std_it != std_set.rend(); ++std_it) {
+    ASSERT_EQ(*--my_it, *std_it);
+  }
+  ASSERT_TRUE(my_it == my_set.begin());
+
+  while (!my_set.empty()) {
+    my_set.erase(my_set.begin());
+  }
+  ASSERT_TRUE(my_set.begin() == my_set.end());
+}
+
+TEST(BtreeSetSuite, range_queries_test) {
+  btree_set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 3000; i += 3) {
+    my_set.insert(i);
+    std_set.insert(i);
+  }
+
+  for (int key = -2; key < 3005; ++key) {
+    auto my_lower = my_set.lower_bound(key);
+    auto my_upper = my_set.upper_bound(key);
+    if (std_set.lower_bound(key) == std_set.end()) {
+      ASSERT_TRUE(my_lower == my_set.end());
+    } else {
+      ASSERT_EQ(*my_lower, *std_set.lower_bound(key));
+    }
+    if (std_set.upper_bound(key) == std_set.end()) {
+      ASSERT_TRUE(my_upper == my_set.end());
+    } else {
+      ASSERT_EQ(*my_upper, *std_set.upper_bound(key));
+    }
+    ASSERT_EQ(my_set.count(key), std_set.count(key));
+
+    auto range = my_set.equal_range(key);
+    ASSERT_TRUE(range.first == my_lower);
+    ASSERT_TRUE(range.second == my_upper);
+  }
+}
+
+TEST(BtreeSetSuite, hinted_insert_test) {
+  btree_set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 2000; i += 2) {
+    my_set.insert(my_set.end(), i);
+    std_set.insert(i);
+  }
+  for (int i = 1; i < 2000; i += 4) {
+    ASSERT_EQ(*my_set.insert(my_set.lower_bound(i), i), i);
+    ASSERT_EQ(*my_set.emplace_hint(my_set.begin(), i + 2), i + 2);
+    ASSERT_EQ(*my_set.insert(my_set.find(i - 1), i - 1), i - 1);
+    std_set.insert({i, i + 2});
+  }
+  ASSERT_TRUE(btree_sets_equal(my_set, std_set));
+}
+
+TEST(BtreeSetSuite, copy_move_merge_test) {
+  btree_set<std::string, std::less<>> my_set;
+  for (int i = 0; i < 500; ++i) {
+    my_set.insert(std::to_string(i));
+  }
+  btree_set<std::string, std::less<>> my_copy(my_set);
+  btree_set<std::string, std::less<>> my_moved(std::move(my_set));
+  ASSERT_EQ(my_copy.size(), 500U);
+  ASSERT_EQ(my_moved.size(), 500U);
+  ASSERT_TRUE(my_moved.contains(std::string_view("499")));
+
+  btree_set<std::string, std::less<>> other = {"1", "x", "y"};
+  other.merge(my_copy);
+  ASSERT_EQ(other.size(), 502U);
+  ASSERT_TRUE(btree_sets_equal(my_copy,
+                               std::set<std::string, std::less<>>{"1"}));
+
+  other.swap(my_copy);
+  ASSERT_EQ(my_copy.size(), 502U);
+  ASSERT_EQ(*my_copy.lower_bound(std::string_view("w")), "x");
+  my_copy.clear();
+  ASSERT_TRUE(my_copy.empty());
+}
+
+}  // namespace s21
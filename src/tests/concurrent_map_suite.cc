@@ -0,0 +1,79 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+TEST(ConcurrentMapSuite, single_thread_test) {
+  concurrent_map<int, std::string, 4> my_map = {{1, "a"}, {2, "b"}};
+  ASSERT_EQ(my_map.size(), 2U);
+  ASSERT_TRUE(my_map.insert(3, "c"));
+  ASSERT_FALSE(my_map.insert(3, "cc"));
+  ASSERT_EQ(*my_map.find(3), "c");
+  ASSERT_FALSE(my_map.insert_or_assign(3, "cc"));
+  ASSERT_EQ(*my_map.find(3), "cc");
+  ASSERT_FALSE(my_map.find(4).has_value());
+
+  ASSERT_TRUE(my_map.erase(1));
+  ASSERT_FALSE(my_map.erase(1));
+  ASSERT_FALSE(my_map.contains(1));
+
+  std::map<int, std::string> seen;
+  my_map.for_each([&seen](const std::pair<int, std::string> &value) {
+    seen.insert(value);
+  });
+  ASSERT_EQ(seen, (std::map<int, std::string>{{2, "b"}, {3, "cc"}}));
+
+  my_map.for_each([](std::pair<int, std::string> &value) {
+    value.second += "!";
+  });
+  ASSERT_EQ(*my_map.find(2), "b!");
+
+  my_map.clear();
+  ASSERT_TRUE(my_map.empty());
+}
+
+// Writers own disjoint key ranges while readers hammer the same shards
+TEST(ConcurrentMapSuite, threads_test) {
+  concurrent_map<int, int> my_map;
+  const int kWriters = 4;
+  const int kPerWriter = 2000;
+
+  std::vector<std::thread> threads;
+  for (int writer = 0; writer < kWriters; ++writer) {
+    threads.emplace_back([&my_map, writer] {
+      for (int i = 0; i < kPerWriter; ++i) {
+        int key = writer * kPerWriter + i;
+        my_map.insert_or_assign(key, key * 2);
+        if (i % 4 == 0) {
+          my_map.erase(key);
+        }
+      }
+    });
+  }
+  threads.emplace_back([&my_map] {
+    for (int i = 0; i < kWriters * kPerWriter; ++i) {
+      std::optional<int> found = my_map.find(i);
+      if (found.has_value() && *found != i * 2) {
+        ADD_FAILURE() << "torn value for key " << i;
+      }
+    }
+  });
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(my_map.size(), size_t(kWriters * kPerWriter / 4 * 3));
+  for (int key = 0; key < kWriters * kPerWriter; ++key) {
+    ASSERT_EQ(my_map.contains(key), key % kPerWriter % 4 != 0);
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,95 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+TEST(FlatMapSuite, access_test) {
+  flat_map<int, std::string> my_map = {{2, "two"}, {1, "one"}, {2, "dup"}};
+  ASSERT_EQ(my_map.size(), 2U);
+  ASSERT_EQ(my_map.at(2), "two");
+  ASSERT_THROW(my_map.at(3), std::out_of_range);
+  my_map[3] = "three";
+  ASSERT_EQ(my_map.at(3), "three");
+  ASSERT_EQ(my_map[0], "");
+  ASSERT_EQ((*my_map.begin()).first, 0);
+}
+
+TEST(FlatMapSuite, insert_test) {
+  flat_map<long, int> my_map;
+  ASSERT_TRUE(my_map.insert(1, 10).second);
+  ASSERT_FALSE(my_map.insert({1, 20}).second);
+  ASSERT_FALSE(my_map.insert_or_assign(1, 30).second);
+  ASSERT_EQ(my_map.at(1), 30);
+
+  auto it = my_map.emplace_hint(my_map.end(), 5, 50);
+  ASSERT_EQ((*it).second, 50);
+  it = my_map.insert(my_map.begin(), {3, 33});
+  ASSERT_EQ((*it).first, 3);
+  ASSERT_EQ(my_map.rank(5), 2U);
+}
+
+TEST(FlatMapSuite, batch_insert_test) {
+  flat_map<int, int> my_map = {{10, 1}, {30, 3}};
+  std::vector<std::pair<int, int>> batch = {{20, 2}, {10, 9}, {40, 4}, {20, 8}};
+  my_map.insert(batch.begin(), batch.end());
+
+  std::vector<std::pair<int, int>> expected = {
+      {10, 1}, {20, 2}, {30, 3}, {40, 4}};
+  ASSERT_EQ(my_map.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(*my_map.nth(i), expected[i]);
+  }
+
+  flat_map<int, int> loaded(kSorted, expected.begin(), expected.end());
+  ASSERT_EQ(loaded.at(40), 4);
+  loaded.shrink_to_fit();
+  ASSERT_EQ(loaded.size(), 4U);
+}
+
+TEST(FlatMapSuite, erase_merge_test) {
+  flat_map<int, int> my_map;
+  for (int i = 0; i < 100; ++i) {
+    my_map.insert(i, i * i);
+  }
+  for (int i = 0; i < 100; i += 2) {
+    my_map.erase(my_map.find(i));
+  }
+  ASSERT_EQ(my_map.size(), 50U);
+  ASSERT_EQ((*my_map.lower_bound(10)).first, 11);
+
+  flat_map<int, int> other = {{11, -1}, {200, 4}};
+  my_map.merge(other);
+  ASSERT_EQ(my_map.size(), 51U);
+  ASSERT_EQ(my_map.at(11), 121);
+  ASSERT_EQ(other.size(), 1U);
+  ASSERT_EQ((*other.begin()).second, -1);
+}
+
+// Counts default constructions
+struct flat_map_defaulted {
+  flat_map_defaulted() { ++made; }
+
+  int value_ = 0;
+  static inline int made = 0;
+};
+
+TEST(FlatMapSuite, subscript_hit_constructs_nothing_test) {
+  flat_map<int, flat_map_defaulted> my_map;
+  int made = flat_map_defaulted::made;
+  my_map[1].value_ = 5;
+  ASSERT_EQ(flat_map_defaulted::made, made + 1);
+  made = flat_map_defaulted::made;
+  ASSERT_EQ(my_map[1].value_, 5);
+  ASSERT_EQ(flat_map_defaulted::made, made);
+  ASSERT_EQ(my_map.size(), 1U);
+}
+
+}  // namespace s21
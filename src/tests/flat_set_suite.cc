@@ -0,0 +1,110 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <class T, class Compare>
+bool flat_sets_equal(const flat_set<T, Compare> &first,
+                     const std::set<T, Compare> &second) {
+  if (first.size() != second.size()) {
+    return false;
+  }
+  auto first_it = first.begin();
+  auto second_it = second.begin();
+  for (; first_it != first.end() && second_it != second.end();
+       ++first_it, ++second_it) {
+    if (*first_it != *second_it) {
+      return false;
+    }
+  }
+
+  return first_it == first.end() && second_it == second.end();
+}
+
+TEST(FlatSetSuite, empty_test) {
+  flat_set<int> my_set;
+  ASSERT_TRUE(my_set.empty());
+  ASSERT_EQ(my_set.size(), 0U);
+  ASSERT_TRUE(my_set.begin() == my_set.end());
+  ASSERT_TRUE(my_set.find(1) == my_set.end());
+}
+
+TEST(FlatSetSuite, insert_erase_test) {
+  flat_set<int> my_set = {5, 1, 4, 1, 3};
+  ASSERT_TRUE(flat_sets_equal(my_set, std::set<int>{1, 3, 4, 5}));
+  ASSERT_EQ(*my_set.insert(2).first, 2);
+  ASSERT_EQ(*my_set.insert(6).first, 6);
+  ASSERT_FALSE(my_set.insert(2).second);
+  ASSERT_TRUE(my_set.insert(2).first == my_set.end());
+
+  my_set.erase(my_set.find(1));
+  my_set.erase(my_set.find(6));
+  ASSERT_TRUE(flat_sets_equal(my_set, std::set<int>{2, 3, 4, 5}));
+}
+
+TEST(FlatSetSuite, batch_insert_test) {
+  flat_set<int> my_set = {10, 20, 30};
+  std::vector<int> batch = {25, 5, 20, 35, 5, 15};
+  my_set.insert(batch.begin(), batch.end());
+  ASSERT_TRUE(
+      flat_sets_equal(my_set, std::set<int>{5, 10, 15, 20, 25, 30, 35}));
+
+  std::vector<int> sorted = {1, 2, 3};
+  flat_set<int> loaded(kSorted, sorted.begin(), sorted.end());
+  ASSERT_EQ(loaded.size(), 3U);
+  ASSERT_TRUE(loaded.contains(2));
+}
+
+TEST(FlatSetSuite, queries_test) {
+  flat_set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 300; i += 3) {
+    my_set.insert(my_set.end(), i);
+    std_set.insert(i);
+  }
+
+  for (int key = -2; key < 305; ++key) {
+    auto my_lower = my_set.lower_bound(key);
+    if (std_set.lower_bound(key) == std_set.end()) {
+      ASSERT_TRUE(my_lower == my_set.end());
+    } else {
+      ASSERT_EQ(*my_lower, *std_set.lower_bound(key));
+    }
+    auto range = my_set.equal_range(key);
+    ASSERT_TRUE(range.first == my_lower);
+    ASSERT_TRUE(range.second == my_set.upper_bound(key));
+    ASSERT_EQ(my_set.count(key), std_set.count(key));
+    auto std_rank = std::distance(std_set.begin(), std_set.lower_bound(key));
+    ASSERT_EQ(my_set.rank(key), static_cast<size_t>(std_rank));
+  }
+  ASSERT_EQ(*my_set.nth(10), 30);
+  ASSERT_TRUE(my_set.nth(100) == my_set.end());
+}
+
+TEST(FlatSetSuite, copy_move_merge_test) {
+  flat_set<std::string, std::less<>> my_set = {"b", "d", "f"};
+  flat_set<std::string, std::less<>> my_copy(my_set);
+  flat_set<std::string, std::less<>> my_moved(std::move(my_set));
+  ASSERT_TRUE(my_moved.contains(std::string_view("d")));
+
+  flat_set<std::string, std::less<>> other = {"a", "d", "g"};
+  my_copy.merge(other);
+  ASSERT_TRUE(flat_sets_equal(
+      my_copy, std::set<std::string, std::less<>>{"a", "b", "d", "f", "g"}));
+  ASSERT_TRUE(flat_sets_equal(other, std::set<std::string, std::less<>>{"d"}));
+
+  other.swap(my_copy);
+  ASSERT_EQ(other.size(), 5U);
+  other.clear();
+  ASSERT_TRUE(other.empty());
+}
+
+}  // namespace s21
@@ -0,0 +1,54 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+TEST(FrozenSetSuite, empty_test) {
+  frozen_set<int> frozen;
+  ASSERT_TRUE(frozen.empty());
+  ASSERT_FALSE(frozen.contains(0));
+
+  frozen_set<int> from_empty = set<int>().freeze();
+  ASSERT_EQ(from_empty.size(), 0U);
+  ASSERT_FALSE(from_empty.contains(0));
+}
+
+// Every size up to a few full levels, so each shape of the last level is
+// walked; odd keys are present, even ones fall in the gaps and past both
+// ends
+TEST(FrozenSetSuite, every_shape_test) {
+  set<int> my_set;
+  for (int count = 0; count < 70; ++count) {
+    frozen_set<int> frozen = my_set.freeze();
+    ASSERT_EQ(frozen.size(), size_t(count));
+    for (int key = -1; key <= count * 2 + 1; ++key) {
+      ASSERT_EQ(frozen.contains(key), my_set.contains(key)) << key;
+    }
+    my_set.insert(count * 2 + 1);
+  }
+}
+
+TEST(FrozenSetSuite, compare_test) {
+  set<std::string, std::greater<std::string>> my_set = {"pear", "apple",
+                                                        "fig", "plum"};
+  frozen_set<std::string, std::greater<std::string>> frozen =
+      my_set.freeze();
+  ASSERT_EQ(frozen.count("fig"), 1U);
+  ASSERT_EQ(frozen.count("kiwi"), 0U);
+  ASSERT_EQ(frozen.count("zucchini"), 0U);
+
+  std::vector<int> sorted = {1, 4, 9, 16};
+  frozen_set<int> from_range(kSorted, sorted.begin(), sorted.end());
+  ASSERT_TRUE(from_range.contains(16));
+  ASSERT_FALSE(from_range.contains(5));
+}
+
+}  // namespace s21
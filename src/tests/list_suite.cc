@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <memory>
+#include <string>
 
 #include "../s21_containers.h"
 
@@ -554,4 +556,30 @@ TEST(ListSuite, sort_test) {
   ASSERT_TRUE(lists_equal(a, b));
 }
 
+TEST(ListSuite, emplace_and_insert_many_test) {
+  list<std::string> a;
+  std::list<std::string> b = {"aaa", "b", "c", "e", "dd", "f"};
+  a.emplace_back(3U, 'a');
+  a.insert_many_back("e", std::string(1, 'f'));
+  auto first = a.insert_many(++a.cbegin(), "b", "c");
+  ASSERT_EQ(*first, "b");
+  ASSERT_EQ(*a.emplace(--a.cend(), 2U, 'd'), "dd");
+  ASSERT_EQ(a.size(), 6);
+  ASSERT_TRUE(lists_equal(a, b));
+
+  a.insert_many_front("x", "y");
+  ASSERT_EQ(a.front(), "x");
+  ASSERT_EQ(*(++a.begin()), "y");
+  ASSERT_EQ(a.back(), "f");
+
+  list<std::unique_ptr<int>> owners;
+  owners.push_back(std::make_unique<int>(1));
+  owners.push_front(std::make_unique<int>(0));
+  owners.emplace_back(new int(2));
+  int expected = 0;
+  for (auto it = owners.begin(); it != owners.end(); ++it) {
+    ASSERT_EQ(**it, expected++);
+  }
+}
+
 }  // namespace s21
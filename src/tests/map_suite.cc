@@ -3,6 +3,9 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../s21_containers.h"
 
@@ -43,6 +46,39 @@ bool maps_equal(map<K, V> first, map<K, V> second) {
   return first_it == first.end() && second_it == second.end();
 }
 
+// Black nodes on every path from node down to a null leaf, or -1 if a red
+// node has a red child or two paths disagree
+template <class Node>
+int black_height(const Node *node) {
+  if (node == nullptr) {
+    return 1;
+  }
+  int left = black_height(node->get_left());
+  int right = black_height(node->get_right());
+  if (left < 0 || left != right) {
+    return -1;
+  }
+  if (node->get_color() == node_color::kBlack) {
+    return left + 1;
+  }
+  for (const Node *child : {node->get_left(), node->get_right()}) {
+    if (child != nullptr && child->get_color() == node_color::kRed) {
+      return -1;
+    }
+  }
+  return left;
+}
+
+// The root hangs off the header, which is the node of end()
+template <class K, class V>
+bool is_red_black(const map<K, V> &my_map) {
+  const auto *root = my_map.end().get_node()->get_parent();
+  if (root == nullptr) {
+    return true;
+  }
+  return root->get_color() == node_color::kBlack && black_height(root) > 0;
+}
+
 TEST(MapSuite, default_contructor_test) {
   map<int, std::string> my_map;
   std::map<int, std::string> std_map;
@@ -317,4 +353,270 @@ TEST(MapSuite, insert_or_assign_empty_test) {
   ASSERT_TRUE(maps_equal(first_map, second_map));
 }
 
+TEST(MapSuite, sorted_insert_erase_test) {
+  map<int, int> my_map;
+  std::map<int, int> std_map;
+  for (int i = 1000; i > 0; --i) {
+    my_map.insert(i, -i);
+    std_map.insert({i, -i});
+  }
+  ASSERT_TRUE(maps_equal(my_map, std_map));
+
+  for (int i = 2; i <= 1000; i += 2) {
+    auto it = my_map.begin();
+    while ((*it).first != i) {
+      ++it;
+    }
+    my_map.erase(it);
+    std_map.erase(i);
+  }
+  ASSERT_TRUE(maps_equal(my_map, std_map));
+}
+
+TEST(MapSuite, bounds_after_modifications_test) {
+  map<int, int> my_map = {{5, 5}, {3, 3}, {8, 8}};
+  my_map.insert(1, 1);
+  my_map.insert(9, 9);
+  ASSERT_EQ((*my_map.begin()).first, 1);
+  ASSERT_EQ((*(--my_map.end())).first, 9);
+
+  my_map.erase(my_map.begin());
+  my_map.erase(--my_map.end());
+  ASSERT_EQ(my_map.size(), 3);
+  ASSERT_EQ((*my_map.begin()).first, 3);
+  ASSERT_EQ((*(--my_map.end())).first, 8);
+
+  map<int, int> moved(std::move(my_map));
+  ASSERT_TRUE(my_map.empty());
+  ASSERT_EQ(moved.size(), 3);
+}
+
+TEST(MapSuite, access_operator_aggregation_test) {
+  map<int, int> my_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 1000; ++i) {
+    ++my_map[i % 17];
+    ++std_map[i % 17];
+  }
+  ASSERT_TRUE(maps_equal(my_map, std_map));
+}
+
+TEST(MapSuite, insert_or_assign_keeps_position_test) {
+  map<int, int> my_map = {{1, 1}, {2, 2}, {3, 3}};
+  auto res = my_map.insert_or_assign(2, 20);
+  ASSERT_FALSE(res.second);
+  ASSERT_TRUE(res.first == ++my_map.begin());
+  ASSERT_EQ(my_map.size(), 3);
+}
+
+TEST(MapSuite, find_test) {
+  map<int, int> my_map = {{1, 10}, {2, 20}, {3, 30}};
+  ASSERT_EQ((*my_map.find(2)).second, 20);
+  ASSERT_TRUE(my_map.find(4) == my_map.end());
+  ASSERT_EQ(my_map.count(3), 1);
+  ASSERT_EQ(my_map.count(0), 0);
+  ASSERT_EQ((*my_map.lower_bound(0)).first, 1);
+}
+
+TEST(MapSuite, transparent_lookup_test) {
+  map<std::string, int, std::less<>> my_map = {{"one", 1}, {"two", 2}};
+
+  ASSERT_EQ((*my_map.find(std::string_view("two"))).second, 2);
+  ASSERT_TRUE(my_map.find("three") == my_map.end());
+  ASSERT_TRUE(my_map.contains("one"));
+  ASSERT_EQ(my_map.count(std::string_view("one")), 1);
+  ASSERT_EQ((*my_map.lower_bound("p")).first, "two");
+}
+
+TEST(MapSuite, large_copy_clear_test) {
+  map<int, int> my_map;
+  for (int i = 0; i < 100000; ++i) {
+    my_map.insert(i, i);
+  }
+  map<int, int> my_copy(my_map);
+  my_map.clear();
+
+  ASSERT_TRUE(my_map.empty());
+  ASSERT_EQ(my_copy.size(), 100000);
+  ASSERT_EQ((*(--my_copy.end())).first, 99999);
+
+  my_map.insert(1, 1);
+  ASSERT_EQ(my_map.size(), 1);
+}
+
+TEST(MapSuite, range_constructors_test) {
+  std::map<int, std::string> std_map = {{1, "a"}, {2, "b"}, {3, "c"}};
+  map<int, std::string> unsorted(std_map.rbegin(), std_map.rend());
+  map<int, std::string> sorted(kSorted, std_map.begin(), std_map.end());
+
+  ASSERT_TRUE(maps_equal(unsorted, std_map));
+  ASSERT_TRUE(maps_equal(sorted, std_map));
+}
+
+TEST(MapSuite, copy_is_independent_test) {
+  map<int, int> my_map = {{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  map<int, int> my_copy;
+  my_copy = my_map;
+  my_copy[2] = 20;
+  my_copy.erase(my_copy.begin());
+
+  ASSERT_TRUE(
+      maps_equal(my_map, std::map<int, int>{{1, 1}, {2, 2}, {3, 3}, {4, 4}}));
+  ASSERT_TRUE(maps_equal(my_copy, std::map<int, int>{{2, 20}, {3, 3}, {4, 4}}));
+}
+
+TEST(MapSuite, extract_insert_node_test) {
+  map<int, int> first_map = {{1, 10}, {2, 20}};
+  map<int, int> second_map;
+
+  map<int, int>::node_type node = first_map.extract(2);
+  ASSERT_TRUE(static_cast<bool>(node));
+  node.value().second = 21;
+
+  map<int, int>::insert_return_type result = second_map.insert(std::move(node));
+  ASSERT_TRUE(result.inserted);
+  ASSERT_EQ((*result.position).second, 21);
+  ASSERT_TRUE(maps_equal(first_map, std::map<int, int>{{1, 10}}));
+  ASSERT_TRUE(maps_equal(second_map, std::map<int, int>{{2, 21}}));
+}
+
+TEST(MapSuite, merge_keeps_duplicates_test) {
+  map<int, int> first_map = {{1, 1}, {3, 3}};
+  map<int, int> second_map = {{1, -1}, {2, -2}, {4, -4}};
+
+  first_map.merge(second_map);
+  ASSERT_TRUE(maps_equal(first_map,
+                         std::map<int, int>{{1, 1}, {2, -2}, {3, 3}, {4, -4}}));
+  ASSERT_TRUE(maps_equal(second_map, std::map<int, int>{{1, -1}}));
+}
+
+TEST(MapSuite, pool_allocator_test) {
+  map<int, std::string, std::less<int>, pool_node_allocator> my_map;
+  std::map<int, std::string> std_map;
+  for (int i = 0; i < 5000; ++i) {
+    my_map[i * 7 % 4999] += "a";
+    std_map[i * 7 % 4999] += "a";
+  }
+  for (int i = 0; i < 4000; i += 3) {
+    my_map.erase(my_map.find(i));
+    std_map.erase(i);
+  }
+
+  map<int, std::string, std::less<int>, pool_node_allocator> my_copy = my_map;
+  my_map.clear();
+  ASSERT_EQ(my_copy.size(), std_map.size());
+  auto my_it = my_copy.begin();
+  for (const auto &elem : std_map) {
+    ASSERT_EQ((*my_it).first, elem.first);
+    ASSERT_EQ((*my_it).second, elem.second);
+    ++my_it;
+  }
+}
+
+TEST(MapSuite, order_statistics_test) {
+  map<int, int> my_map;
+  for (int i = 0; i < 100; ++i) {
+    my_map.insert(i * 10, i);
+  }
+  map<int, int> my_copy(my_map);
+  my_copy.erase(my_copy.find(500));
+
+  ASSERT_EQ((*my_map.nth(50)).second, 50);
+  ASSERT_EQ((*my_copy.nth(50)).second, 51);
+  ASSERT_EQ(my_copy.rank(505), 50U);
+  ASSERT_EQ((*(my_copy.begin() + 75)).first, 760);
+  ASSERT_EQ((*(my_copy.end() - 99)).first, 0);
+}
+
+TEST(MapSuite, time_range_scan_test) {
+  map<long, int> my_map;
+  for (int i = 0; i < 100; ++i) {
+    my_map.insert(i * 10L, i);
+  }
+
+  int sum = 0;
+  for (auto it = my_map.lower_bound(250); it != my_map.upper_bound(400);
+       ++it) {
+    sum += (*it).second;
+  }
+  ASSERT_EQ(sum, 25 + 26 + 27 + 28 + 29 + 30 + 31 + 32 + 33 + 34 + 35 + 36 +
+                     37 + 38 + 39 + 40);
+
+  auto empty = my_map.equal_range(255);
+  ASSERT_TRUE(empty.first == empty.second);
+  ASSERT_EQ((*empty.first).first, 260);
+  ASSERT_TRUE(my_map.upper_bound(990) == my_map.end());
+}
+
+TEST(MapSuite, hinted_insert_test) {
+  std::vector<std::pair<int, std::string>> sorted;
+  for (int i = 0; i < 100; ++i) {
+    sorted.emplace_back(i * 2, std::to_string(i));
+  }
+  map<int, std::string> my_map(sorted.begin(), sorted.end());
+  ASSERT_EQ(my_map.size(), 100U);
+  ASSERT_EQ((*my_map.nth(40)).second, "40");
+
+  auto it = my_map.emplace_hint(my_map.find(42), 41, "odd");
+  ASSERT_EQ((*it).second, "odd");
+  ASSERT_TRUE(++it == my_map.find(42));
+  it = my_map.insert(my_map.end(), {42, "other"});
+  ASSERT_EQ((*it).second, "21");
+  ASSERT_EQ(my_map.size(), 101U);
+  ASSERT_EQ(my_map.rank(42), 22U);
+}
+
+// Counts default constructions
+struct map_defaulted {
+  map_defaulted() { ++made; }
+
+  int value_ = 0;
+  static inline int made = 0;
+};
+
+TEST(MapSuite, subscript_hit_constructs_nothing_test) {
+  map<int, map_defaulted> my_map;
+  int made = map_defaulted::made;
+  my_map[1].value_ = 5;
+  ASSERT_EQ(map_defaulted::made, made + 1);
+  made = map_defaulted::made;
+  ASSERT_EQ(my_map[1].value_, 5);
+  ASSERT_EQ(map_defaulted::made, made);
+  ASSERT_EQ(my_map.size(), 1U);
+}
+
+TEST(MapSuite, red_black_invariants_test) {
+  map<int, int> ascending;
+  map<int, int> descending;
+  for (int i = 0; i < 2000; ++i) {
+    ascending.insert(i, i);
+    descending.insert(-i, i);
+    if (i % 97 == 0) {
+      ASSERT_TRUE(is_red_black(ascending));
+      ASSERT_TRUE(is_red_black(descending));
+    }
+  }
+  ASSERT_TRUE(is_red_black(ascending));
+  ASSERT_TRUE(is_red_black(descending));
+
+  for (int i = 0; i < 2000; i += 3) {
+    ascending.erase(ascending.find(i));
+    descending.erase(descending.find(-i));
+    if (i % 99 == 0) {
+      ASSERT_TRUE(is_red_black(ascending));
+      ASSERT_TRUE(is_red_black(descending));
+    }
+  }
+  ASSERT_TRUE(is_red_black(ascending));
+  ASSERT_TRUE(is_red_black(descending));
+
+  for (int i = 1; i < 2000; ++i) {
+    if (ascending.contains(i)) {
+      ascending.erase(ascending.find(i));
+    }
+  }
+  ASSERT_TRUE(is_red_black(ascending));
+  ASSERT_TRUE(ascending.empty());
+}
+
 }  // namespace s21
@@ -0,0 +1,60 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+TEST(MultimapSuite, insert_keeps_order_of_equal_keys_test) {
+  multimap<int, std::string> my_multimap;
+  my_multimap.insert(2, "b1");
+  my_multimap.insert({1, "a"});
+  my_multimap.insert(2, "b2");
+  my_multimap.insert(2, "b3");
+
+  auto range = my_multimap.equal_range(2);
+  std::string joined;
+  for (auto it = range.first; it != range.second; ++it) {
+    joined += (*it).second;
+  }
+  ASSERT_EQ(joined, "b1b2b3");
+  ASSERT_EQ(my_multimap.count(2), 3U);
+  ASSERT_EQ((*my_multimap.begin()).second, "a");
+}
+
+TEST(MultimapSuite, against_std_test) {
+  multimap<int, int> my_multimap;
+  std::multimap<int, int> std_multimap;
+  for (int i = 0; i < 800; ++i) {
+    my_multimap.insert(i % 41, i);
+    std_multimap.insert({i % 41, i});
+  }
+  for (int key = 0; key < 41; key += 3) {
+    ASSERT_EQ(my_multimap.erase(key), std_multimap.erase(key));
+  }
+
+  ASSERT_EQ(my_multimap.size(), std_multimap.size());
+  auto my_it = my_multimap.begin();
+  for (const auto &elem : std_multimap) {
+    ASSERT_EQ((*my_it).first, elem.first);
+    ASSERT_EQ((*my_it).second, elem.second);
+    ++my_it;
+  }
+}
+
+TEST(MultimapSuite, merge_test) {
+  multimap<int, int> first_multimap = {{1, 1}, {2, 2}};
+  multimap<int, int> second_multimap = {{1, 10}, {3, 30}};
+
+  first_multimap.merge(second_multimap);
+  ASSERT_TRUE(second_multimap.empty());
+  ASSERT_EQ(first_multimap.size(), 4U);
+  ASSERT_EQ((*first_multimap.nth(1)).second, 10);
+  ASSERT_EQ(first_multimap.count(1), 2U);
+}
+
+}  // namespace s21
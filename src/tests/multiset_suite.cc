@@ -0,0 +1,117 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <set>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <class T>
+bool multisets_equal(const multiset<T> &first, const std::multiset<T> &second) {
+  if (first.size() != second.size()) {
+    return false;
+  }
+  auto first_it = first.begin();
+  auto second_it = second.begin();
+  for (; first_it != first.end() && second_it != second.end();
+       ++first_it, ++second_it) {
+    if (*first_it != *second_it) {
+      return false;
+    }
+  }
+
+  return first_it == first.end() && second_it == second.end();
+}
+
+TEST(MultisetSuite, empty_test) {
+  multiset<int> my_multiset;
+  ASSERT_TRUE(my_multiset.empty());
+  ASSERT_EQ(my_multiset.size(), 0U);
+  ASSERT_TRUE(my_multiset.begin() == my_multiset.end());
+}
+
+TEST(MultisetSuite, insert_duplicates_test) {
+  multiset<int> my_multiset = {3, 1, 3, 2, 3, 1};
+  ASSERT_TRUE(
+      multisets_equal(my_multiset, std::multiset<int>{3, 1, 3, 2, 3, 1}));
+  ASSERT_EQ(*my_multiset.insert(2), 2);
+  ASSERT_EQ(my_multiset.size(), 7U);
+}
+
+TEST(MultisetSuite, count_test) {
+  multiset<int> my_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < 1000; ++i) {
+    my_multiset.insert(i % 37);
+    std_multiset.insert(i % 37);
+  }
+
+  for (int key = -1; key < 40; ++key) {
+    ASSERT_EQ(my_multiset.count(key), std_multiset.count(key));
+  }
+  ASSERT_TRUE(my_multiset.contains(36));
+  ASSERT_FALSE(my_multiset.contains(37));
+}
+
+TEST(MultisetSuite, equal_range_test) {
+  multiset<int> my_multiset = {1, 2, 2, 2, 3, 5};
+
+  auto range = my_multiset.equal_range(2);
+  ASSERT_TRUE(range.first == my_multiset.lower_bound(2));
+  ASSERT_TRUE(range.second == my_multiset.upper_bound(2));
+  ASSERT_TRUE(range.first == my_multiset.nth(1));
+  ASSERT_EQ(*range.second, 3);
+
+  range = my_multiset.equal_range(4);
+  ASSERT_TRUE(range.first == range.second);
+  ASSERT_EQ(*range.first, 5);
+  ASSERT_EQ(my_multiset.rank(3), 4U);
+}
+
+TEST(MultisetSuite, erase_key_test) {
+  multiset<int> my_multiset;
+  std::multiset<int> std_multiset;
+  for (int i = 0; i < 500; ++i) {
+    my_multiset.insert(i * 7 % 23);
+    std_multiset.insert(i * 7 % 23);
+  }
+
+  for (int key = 0; key < 23; key += 2) {
+    ASSERT_EQ(my_multiset.erase(key), std_multiset.erase(key));
+  }
+  ASSERT_EQ(my_multiset.erase(100), 0U);
+  ASSERT_TRUE(multisets_equal(my_multiset, std_multiset));
+
+  my_multiset.erase(my_multiset.find(1));
+  std_multiset.erase(std_multiset.find(1));
+  ASSERT_TRUE(multisets_equal(my_multiset, std_multiset));
+}
+
+TEST(MultisetSuite, merge_test) {
+  multiset<int> first_multiset = {1, 2, 2};
+  multiset<int> second_multiset = {2, 3, 1};
+
+  first_multiset.merge(second_multiset);
+  ASSERT_TRUE(second_multiset.empty());
+  ASSERT_TRUE(
+      multisets_equal(first_multiset, std::multiset<int>{1, 1, 2, 2, 2, 3}));
+}
+
+TEST(MultisetSuite, copy_move_swap_test) {
+  multiset<int> my_multiset = {4, 4, 1};
+  multiset<int> my_copy(my_multiset);
+  multiset<int> my_moved(std::move(my_multiset));
+  ASSERT_TRUE(multisets_equal(my_copy, std::multiset<int>{1, 4, 4}));
+  ASSERT_TRUE(multisets_equal(my_moved, std::multiset<int>{1, 4, 4}));
+
+  multiset<int> other = {7};
+  other.swap(my_copy);
+  ASSERT_TRUE(multisets_equal(other, std::multiset<int>{1, 4, 4}));
+  ASSERT_TRUE(multisets_equal(my_copy, std::multiset<int>{7}));
+  my_copy.clear();
+  ASSERT_TRUE(my_copy.empty());
+}
+
+}  // namespace s21
@@ -0,0 +1,133 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <class K, class T>
+bool persistent_maps_equal(const persistent_map<K, T> &first,
+                           const std::map<K, T> &second) {
+  if (first.size() != second.size()) {
+    return false;
+  }
+  auto first_it = first.begin();
+  auto second_it = second.begin();
+  for (; first_it != first.end() && second_it != second.end();
+       ++first_it, ++second_it) {
+    if ((*first_it).first != (*second_it).first ||
+        (*first_it).second != (*second_it).second) {
+      return false;
+    }
+  }
+
+  return first_it == first.end() && second_it == second.end();
+}
+
+TEST(PersistentMapSuite, versions_test) {
+  persistent_map<int, std::string> empty;
+  persistent_map<int, std::string> first = empty.insert(2, "b").insert(1, "a");
+  persistent_map<int, std::string> second = first.insert_or_assign(1, "A");
+  persistent_map<int, std::string> third = second.erase(2).insert(3, "c");
+
+  ASSERT_TRUE(empty.empty());
+  ASSERT_TRUE(persistent_maps_equal(
+      first, std::map<int, std::string>{{1, "a"}, {2, "b"}}));
+  ASSERT_TRUE(persistent_maps_equal(
+      second, std::map<int, std::string>{{1, "A"}, {2, "b"}}));
+  ASSERT_TRUE(persistent_maps_equal(
+      third, std::map<int, std::string>{{1, "A"}, {3, "c"}}));
+
+  ASSERT_EQ(first.insert(1, "x").at(1), "a");
+  ASSERT_EQ(third.erase(2).size(), 2U);
+  ASSERT_THROW(third.at(2), std::out_of_range);
+  ASSERT_EQ((*third.find(3)).second, "c");
+  ASSERT_TRUE(third.find(2) == third.end());
+  ASSERT_EQ(second.count(2), 1U);
+}
+
+TEST(PersistentMapSuite, moved_from_test) {
+  persistent_map<int, std::string> first = {{1, "a"}, {2, "b"}};
+  persistent_map<int, std::string> second(std::move(first));
+  ASSERT_EQ(second.size(), 2U);
+  ASSERT_TRUE(first.empty());
+  ASSERT_EQ(first.size(), 0U);
+  ASSERT_TRUE(first.begin() == first.end());
+  ASSERT_EQ(first.insert(3, "c").size(), 1U);
+
+  persistent_map<int, std::string> third;
+  third = std::move(second);
+  ASSERT_EQ(third.size(), 2U);
+  ASSERT_TRUE(second.empty());
+  ASSERT_EQ(second.insert(1, "a").size(), 1U);
+}
+
+TEST(PersistentMapSuite, find_iterates_on_test) {
+  persistent_map<int, int> my_map;
+  for (int i = 0; i < 100; ++i) {
+    my_map = my_map.insert(i * 3 % 100, i);
+  }
+
+  int expected = 40;
+  for (auto it = my_map.find(40); it != my_map.end(); ++it, ++expected) {
+    ASSERT_EQ((*it).first, expected);
+  }
+  ASSERT_EQ(expected, 100);
+}
+
+TEST(PersistentMapSuite, random_updates_test) {
+  persistent_map<int, int> my_map;
+  std::map<int, int> std_map;
+  persistent_map<int, int> snapshot;
+  std::map<int, int> std_snapshot;
+  for (int i = 0; i < 3000; ++i) {
+    int key = i * 7919 % 1009;
+    if (i % 3 == 2) {
+      my_map = my_map.erase(key);
+      std_map.erase(key);
+    } else {
+      my_map = my_map.insert_or_assign(key, i);
+      std_map[key] = i;
+    }
+    if (i == 1500) {
+      snapshot = my_map;
+      std_snapshot = std_map;
+    }
+  }
+
+  ASSERT_TRUE(persistent_maps_equal(my_map, std_map));
+  ASSERT_TRUE(persistent_maps_equal(snapshot, std_snapshot));
+}
+
+struct counted {
+  counted() = default;
+  counted(const counted &) { ++copies; }
+  counted(counted &&) = default;
+  counted &operator=(const counted &) = default;
+  counted &operator=(counted &&) = default;
+  static inline int copies = 0;
+};
+
+// Values are copied only on the path to the key, the rest is shared
+TEST(PersistentMapSuite, path_copying_test) {
+  persistent_map<int, counted> my_map;
+  for (int i = 0; i < 1024; ++i) {
+    my_map = my_map.insert(i, counted());
+  }
+  counted::copies = 0;
+  persistent_map<int, counted> updated = my_map.insert(2048, counted());
+  int insert_copies = counted::copies;
+  persistent_map<int, counted> erased = updated.erase(512);
+
+  ASSERT_LE(insert_copies, 20);
+  ASSERT_LE(counted::copies, 40);
+  ASSERT_EQ(my_map.size(), 1024U);
+  ASSERT_EQ(erased.size(), 1024U);
+}
+
+}  // namespace s21
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <queue>
+#include <string>
 
 #include "../s21_containers.h"
 
@@ -245,4 +246,22 @@ TEST(QueueSuite, swap_test) {
   ASSERT_TRUE(queues_equal(second_queue, first_copy));
 }
 
+TEST(QueueSuite, emplace_and_insert_many_test) {
+  queue<std::string> my_queue;
+  std::queue<std::string> std_queue;
+  my_queue.emplace(2U, 'a');
+  std_queue.emplace(2U, 'a');
+  my_queue.insert_many_back("b", std::string("c"));
+  std_queue.push("b");
+  std_queue.push("c");
+
+  ASSERT_EQ(my_queue.size(), std_queue.size());
+  ASSERT_EQ(my_queue.back(), std_queue.back());
+  while (!std_queue.empty()) {
+    ASSERT_EQ(my_queue.front(), std_queue.front());
+    my_queue.pop();
+    std_queue.pop();
+  }
+}
+
 }  // namespace s21
@@ -3,13 +3,17 @@
 #include <gtest/gtest.h>
 
 #include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../s21_containers.h"
 
 namespace s21 {
 
-template <class T>
-bool sets_equal(set<T> first, std::set<T> second) {
+template <class T, template <class> class Alloc>
+bool sets_equal(const set<T, std::less<T>, Alloc> &first,
+                const std::set<T> &second) {
   if (first.size() != second.size()) {
     return false;
   }
@@ -261,4 +265,314 @@ TEST(SetSuite, contains_non_present_test) {
   ASSERT_EQ(res, false);
 }
 
+TEST(SetSuite, sorted_insert_erase_test) {
+  set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 1000; ++i) {
+    my_set.insert(i);
+    std_set.insert(i);
+  }
+  ASSERT_TRUE(sets_equal(my_set, std_set));
+
+  for (int i = 0; i < 1000; i += 3) {
+    my_set.erase(my_set.find(i));
+    std_set.erase(i);
+  }
+  ASSERT_TRUE(sets_equal(my_set, std_set));
+}
+
+TEST(SetSuite, erase_all_test) {
+  set<int> my_set = {5, 3, 8, 1, 4, 7, 9, 2, 6};
+  while (!my_set.empty()) {
+    my_set.erase(my_set.begin());
+  }
+  ASSERT_TRUE(sets_equal(my_set, std::set<int>{}));
+}
+
+TEST(SetSuite, size_after_modifications_test) {
+  set<int> my_set = {3, 1, 2};
+  my_set.insert(2);
+  ASSERT_EQ(my_set.size(), 3);
+  my_set.erase(my_set.begin());
+  ASSERT_EQ(my_set.size(), 2);
+  ASSERT_EQ(*my_set.begin(), 2);
+  ASSERT_EQ(*(--my_set.end()), 3);
+
+  set<int> other;
+  my_set.swap(other);
+  ASSERT_TRUE(my_set.empty());
+  ASSERT_EQ(other.size(), 2);
+  ASSERT_EQ(*other.begin(), 2);
+}
+
+TEST(SetSuite, iterate_both_directions_test) {
+  set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 100; ++i) {
+    my_set.insert(i * 37 % 101);
+    std_set.insert(i * 37 % 101);
+  }
+
+  auto my_it = my_set.end();
+  for (auto std_it = std_set.rbegin(); std_it != std_set.rend(); ++std_it) {
+    --my_it;
+    ASSERT_EQ(*my_it, *std_it);
+  }
+  ASSERT_TRUE(my_it == my_set.begin());
+  ASSERT_TRUE(my_set.begin() != ++my_set.begin());
+}
+
+TEST(SetSuite, custom_compare_test) {
+  set<int, std::greater<int>> my_set = {1, 5, 3, 4, 2};
+  std::set<int, std::greater<int>> std_set = {1, 5, 3, 4, 2};
+
+  auto std_it = std_set.begin();
+  for (auto it = my_set.begin(); it != my_set.end(); ++it, ++std_it) {
+    ASSERT_EQ(*it, *std_it);
+  }
+  ASSERT_EQ(*my_set.lower_bound(3), *std_set.lower_bound(3));
+  ASSERT_TRUE(my_set.lower_bound(0) == my_set.end());
+  ASSERT_TRUE(my_set.contains(3));
+}
+
+TEST(SetSuite, transparent_lookup_test) {
+  set<std::string, std::less<>> my_set = {"apple", "banana", "cherry"};
+
+  ASSERT_EQ(*my_set.find(std::string_view("banana")), "banana");
+  ASSERT_TRUE(my_set.contains("cherry"));
+  ASSERT_FALSE(my_set.contains(std::string_view("durian")));
+  ASSERT_EQ(my_set.count("apple"), 1);
+  ASSERT_EQ(my_set.count("apricot"), 0);
+  ASSERT_EQ(*my_set.lower_bound("b"), "banana");
+  ASSERT_TRUE(my_set.lower_bound("z") == my_set.end());
+}
+
+TEST(SetSuite, range_constructor_test) {
+  int items[] = {5, 1, 4, 1, 3};
+  set<int> my_set(items, items + 5);
+  ASSERT_TRUE(sets_equal(my_set, std::set<int>(items, items + 5)));
+}
+
+TEST(SetSuite, sorted_constructor_test) {
+  for (int count = 0; count < 70; ++count) {
+    std::set<int> std_set;
+    for (int i = 0; i < count; ++i) {
+      std_set.insert(i * 2);
+    }
+    set<int> my_set(kSorted, std_set.begin(), std_set.end());
+    ASSERT_TRUE(sets_equal(my_set, std_set));
+
+    my_set.insert(-1);
+    my_set.erase(my_set.begin());
+    ASSERT_TRUE(sets_equal(my_set, std_set));
+  }
+}
+
+TEST(SetSuite, bulk_load_replaces_content_test) {
+  set<int> my_set = {100, 200};
+  int items[] = {1, 2, 3};
+  my_set.bulk_load(items, items + 3, kSorted);
+  ASSERT_TRUE(sets_equal(my_set, std::set<int>{1, 2, 3}));
+}
+
+TEST(SetSuite, extract_insert_node_test) {
+  set<int> first_set = {1, 2, 3};
+  set<int> second_set = {2};
+
+  set<int>::node_type node = first_set.extract(3);
+  ASSERT_FALSE(node.empty());
+  ASSERT_EQ(node.value(), 3);
+  ASSERT_TRUE(first_set.extract(10).empty());
+
+  set<int>::insert_return_type result = second_set.insert(std::move(node));
+  ASSERT_TRUE(result.inserted);
+  ASSERT_EQ(*result.position, 3);
+  ASSERT_TRUE(result.node.empty());
+
+  result = second_set.insert(first_set.extract(first_set.find(2)));
+  ASSERT_FALSE(result.inserted);
+  ASSERT_EQ(result.node.value(), 2);
+  ASSERT_TRUE(sets_equal(first_set, std::set<int>{1}));
+  ASSERT_TRUE(sets_equal(second_set, std::set<int>{2, 3}));
+}
+
+TEST(SetSuite, merge_keeps_duplicates_test) {
+  set<int> first_set;
+  set<int> second_set;
+  std::set<int> std_first;
+  std::set<int> std_second;
+  for (int i = 0; i < 200; ++i) {
+    (i % 3 ? first_set : second_set).insert(i * 7 % 101);
+    (i % 3 ? std_first : std_second).insert(i * 7 % 101);
+  }
+
+  first_set.merge(second_set);
+  std_first.merge(std_second);
+  ASSERT_TRUE(sets_equal(first_set, std_first));
+  ASSERT_TRUE(sets_equal(second_set, std_second));
+}
+
+TEST(SetSuite, pool_allocator_churn_test) {
+  set<int, std::less<int>, pool_node_allocator> my_set;
+  std::set<int> std_set;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 3000; ++i) {
+      my_set.insert(i * 37 % 3001);
+      std_set.insert(i * 37 % 3001);
+    }
+    for (int i = 0; i < 2000; ++i) {
+      my_set.erase(my_set.find(i * 11 % 3001));
+      std_set.erase(i * 11 % 3001);
+    }
+    ASSERT_TRUE(sets_equal(my_set, std_set));
+  }
+
+  my_set.clear();
+  ASSERT_TRUE(my_set.empty());
+  my_set.insert(5);
+  ASSERT_TRUE(sets_equal(my_set, std::set<int>{5}));
+}
+
+TEST(SetSuite, pool_allocator_nodes_between_trees_test) {
+  set<int, std::less<int>, pool_node_allocator> first_set = {1, 2, 3, 4};
+  set<int, std::less<int>, pool_node_allocator> second_set = {3, 5};
+
+  set<int, std::less<int>, pool_node_allocator>::node_type node =
+      first_set.extract(1);
+  first_set.clear();
+  ASSERT_EQ(node.value(), 1);
+  first_set = {2, 3, 4};
+
+  ASSERT_TRUE(second_set.insert(std::move(node)).inserted);
+  second_set.merge(first_set);
+  ASSERT_TRUE(sets_equal(first_set, std::set<int>{3}));
+  ASSERT_TRUE(sets_equal(second_set, std::set<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(SetSuite, pool_allocator_clear_with_live_node_test) {
+  set<int, std::less<int>, pool_node_allocator> my_set = {0};
+  set<int, std::less<int>, pool_node_allocator>::node_type node =
+      my_set.extract(0);
+
+  std::set<const int *> first_places;
+  for (int round = 0; round < 4; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      const int *place = &*my_set.insert(i).first;
+      // the slots of the cleared nodes are reused, not new ones carved
+      ASSERT_TRUE(round == 0 || first_places.count(place) == 1);
+      first_places.insert(place);
+    }
+    my_set.clear();
+  }
+  ASSERT_EQ(first_places.size(), 1000U);
+  ASSERT_EQ(node.value(), 0);
+}
+
+TEST(SetSuite, order_statistics_test) {
+  set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 600; ++i) {
+    my_set.insert(i * 53 % 599);
+    std_set.insert(i * 53 % 599);
+  }
+  for (int i = 0; i < 300; i += 2) {
+    my_set.erase(my_set.find(i * 7 % 599));
+    std_set.erase(i * 7 % 599);
+  }
+  std::vector<int> sorted(std_set.begin(), std_set.end());
+
+  for (size_t k = 0; k < sorted.size(); ++k) {
+    ASSERT_EQ(*my_set.nth(k), sorted[k]);
+    ASSERT_EQ(my_set.rank(sorted[k]), k);
+  }
+  ASSERT_TRUE(my_set.nth(sorted.size()) == my_set.end());
+  ASSERT_EQ(my_set.rank(1000), sorted.size());
+  ASSERT_EQ(my_set.rank(-1), 0U);
+}
+
+TEST(SetSuite, iterator_advance_test) {
+  set<int> my_set;
+  for (int i = 0; i < 257; ++i) {
+    my_set.insert(i * 3);
+  }
+
+  for (size_t from = 0; from < 257; from += 16) {
+    for (size_t step = 0; from + step <= 257; step += 5) {
+      set<int>::iterator it = my_set.nth(from) + step;
+      if (from + step == 257) {
+        ASSERT_TRUE(it == my_set.end());
+      } else {
+        ASSERT_EQ(*it, static_cast<int>((from + step) * 3));
+      }
+      ASSERT_TRUE(it - step == my_set.nth(from));
+    }
+  }
+  ASSERT_EQ(*(my_set.end() - 1), 256 * 3);
+  ASSERT_TRUE(my_set.begin() + 257 == my_set.end());
+}
+
+TEST(SetSuite, range_queries_test) {
+  set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 200; i += 3) {
+    my_set.insert(i);
+    std_set.insert(i);
+  }
+
+  for (int key = -2; key < 205; ++key) {
+    auto my_lower = my_set.lower_bound(key);
+    auto my_upper = my_set.upper_bound(key);
+    if (std_set.lower_bound(key) == std_set.end()) {
+      ASSERT_TRUE(my_lower == my_set.end());
+    } else {
+      ASSERT_EQ(*my_lower, *std_set.lower_bound(key));
+    }
+    if (std_set.upper_bound(key) == std_set.end()) {
+      ASSERT_TRUE(my_upper == my_set.end());
+    } else {
+      ASSERT_EQ(*my_upper, *std_set.upper_bound(key));
+    }
+
+    auto range = my_set.equal_range(key);
+    ASSERT_TRUE(range.first == my_lower);
+    ASSERT_TRUE(range.second == my_upper);
+  }
+}
+
+TEST(SetSuite, transparent_range_queries_test) {
+  set<std::string, std::less<>> my_set = {"apple", "banana", "cherry"};
+  std::string_view key = "banana";
+
+  ASSERT_EQ(*my_set.upper_bound(key), "cherry");
+  auto range = my_set.equal_range(key);
+  ASSERT_EQ(*range.first, "banana");
+  ASSERT_TRUE(range.second == my_set.upper_bound(key));
+}
+
+TEST(SetSuite, hinted_insert_test) {
+  set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 300; i += 2) {
+    my_set.insert(my_set.end(), i);
+    std_set.insert(i);
+  }
+  // right hints, hints one step off, far off and hints at present keys
+  for (int i = 1; i < 300; i += 4) {
+    set<int>::iterator hint = my_set.lower_bound(i);
+    ASSERT_EQ(*my_set.insert(hint, i), i);
+    ASSERT_EQ(*my_set.emplace_hint(my_set.lower_bound(i - 2), i + 2), i + 2);
+    ASSERT_EQ(*my_set.insert(my_set.begin(), i + 151), i + 151);
+    ASSERT_EQ(*my_set.insert(my_set.find(i - 1), i - 1), i - 1);
+    std_set.insert({i, i + 2, i + 151});
+  }
+  ASSERT_EQ(*my_set.insert(my_set.end(), -1), -1);
+  std_set.insert(-1);
+
+  ASSERT_TRUE(sets_equal(my_set, std_set));
+  std::vector<int> sorted(std_set.begin(), std_set.end());
+  for (size_t k = 0; k < sorted.size(); ++k) {
+    ASSERT_EQ(my_set.rank(sorted[k]), k);
+  }
+}
+
 }  // namespace s21
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <stack>
+#include <string>
 
 #include "../s21_containers.h"
 
@@ -217,4 +218,21 @@ TEST(StackSuite, swap_test) {
   ASSERT_TRUE(stacks_equal(second_stack, first_copy));
 }
 
+TEST(StackSuite, emplace_and_insert_many_test) {
+  stack<std::string> my_stack;
+  std::stack<std::string> std_stack;
+  my_stack.emplace(2U, 'a');
+  std_stack.emplace(2U, 'a');
+  my_stack.insert_many_front("b", std::string("c"));
+  std_stack.push("b");
+  std_stack.push("c");
+
+  ASSERT_EQ(my_stack.size(), std_stack.size());
+  while (!std_stack.empty()) {
+    ASSERT_EQ(my_stack.top(), std_stack.top());
+    my_stack.pop();
+    std_stack.pop();
+  }
+}
+
 }  // namespace s21
@@ -0,0 +1,113 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <class K, class T>
+bool unordered_maps_equal(const unordered_map<K, T> &first,
+                          const std::map<K, T> &second) {
+  std::map<K, T> collected;
+  for (auto it = first.begin(); it != first.end(); ++it) {
+    collected.insert(*it);
+  }
+
+  return first.size() == second.size() && collected == second;
+}
+
+TEST(UnorderedMapSuite, insert_find_test) {
+  unordered_map<std::string, int> my_map = {{"one", 1}, {"two", 2}};
+  ASSERT_EQ((*my_map.insert("three", 3).first).second, 3);
+  ASSERT_FALSE(my_map.insert({"one", 10}).second);
+  ASSERT_TRUE(my_map.insert("one", 10).first == my_map.end());
+  ASSERT_EQ((*my_map.find("one")).second, 1);
+  ASSERT_TRUE(my_map.find("four") == my_map.end());
+  ASSERT_TRUE(my_map.contains("two"));
+  ASSERT_EQ(my_map.count("two"), 1U);
+
+  ASSERT_FALSE(my_map.insert_or_assign("one", 11).second);
+  ASSERT_TRUE(my_map.insert_or_assign("four", 4).second);
+  ASSERT_TRUE(unordered_maps_equal(
+      my_map, std::map<std::string, int>{
+                  {"one", 11}, {"two", 2}, {"three", 3}, {"four", 4}}));
+}
+
+TEST(UnorderedMapSuite, access_test) {
+  unordered_map<int, std::string> my_map = {{1, "a"}, {2, "b"}};
+  ASSERT_EQ(my_map.at(1), "a");
+  ASSERT_THROW(my_map.at(3), std::out_of_range);
+  my_map[3] = "c";
+  my_map[1] += "a";
+  ASSERT_EQ(my_map.size(), 3U);
+  ASSERT_EQ(my_map.at(3), "c");
+  ASSERT_EQ(my_map[1], "aa");
+}
+
+TEST(UnorderedMapSuite, erase_test) {
+  unordered_map<int, int> my_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 2000; ++i) {
+    my_map[i] = i * i;
+    std_map[i] = i * i;
+  }
+  for (int i = 0; i < 2000; i += 2) {
+    my_map.erase(my_map.find(i));
+    std_map.erase(i);
+  }
+
+  ASSERT_TRUE(unordered_maps_equal(my_map, std_map));
+  for (int i = 0; i < 2000; ++i) {
+    ASSERT_EQ(my_map.contains(i), i % 2 == 1);
+  }
+}
+
+TEST(UnorderedMapSuite, erase_end_test) {
+  unordered_map<int, int> my_map;
+  ASSERT_THROW(my_map.erase(my_map.end()), std::out_of_range);
+  my_map = {{1, 1}, {2, 2}};
+  ASSERT_THROW(my_map.erase(my_map.end()), std::out_of_range);
+  ASSERT_EQ(my_map.size(), 2U);
+  ASSERT_TRUE(my_map.contains(1));
+  ASSERT_TRUE(my_map.contains(2));
+}
+
+TEST(UnorderedMapSuite, copy_merge_test) {
+  unordered_map<int, int> my_map = {{1, 10}, {2, 20}};
+  unordered_map<int, int> copy;
+  copy = my_map;
+  copy[3] = 30;
+  ASSERT_EQ(my_map.size(), 2U);
+
+  unordered_map<int, int> other = {{2, 200}, {4, 40}};
+  my_map.merge(other);
+  ASSERT_TRUE(unordered_maps_equal(
+      my_map, std::map<int, int>{{1, 10}, {2, 20}, {4, 40}}));
+  ASSERT_TRUE(unordered_maps_equal(other, std::map<int, int>{{2, 200}}));
+}
+
+// Counts default constructions
+struct unordered_map_defaulted {
+  unordered_map_defaulted() { ++made; }
+
+  int value_ = 0;
+  static inline int made = 0;
+};
+
+TEST(UnorderedMapSuite, subscript_hit_constructs_nothing_test) {
+  unordered_map<int, unordered_map_defaulted> my_map;
+  int made = unordered_map_defaulted::made;
+  my_map[1].value_ = 5;
+  ASSERT_EQ(unordered_map_defaulted::made, made + 1);
+  made = unordered_map_defaulted::made;
+  ASSERT_EQ(my_map[1].value_, 5);
+  ASSERT_EQ(unordered_map_defaulted::made, made);
+  ASSERT_EQ(my_map.size(), 1U);
+}
+
+}  // namespace s21
@@ -0,0 +1,114 @@
+// Copyright 2023 School-21
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../s21_containersplus.h"
+
+namespace s21 {
+
+template <class T>
+bool unordered_sets_equal(const unordered_set<T> &first,
+                          const std::set<T> &second) {
+  std::set<T> collected;
+  for (auto it = first.begin(); it != first.end(); ++it) {
+    collected.insert(*it);
+  }
+
+  return first.size() == second.size() && collected == second;
+}
+
+TEST(UnorderedSetSuite, empty_test) {
+  unordered_set<int> my_set;
+  ASSERT_TRUE(my_set.empty());
+  ASSERT_EQ(my_set.size(), 0U);
+  ASSERT_EQ(my_set.bucket_count(), 0U);
+  ASSERT_TRUE(my_set.begin() == my_set.end());
+  ASSERT_TRUE(my_set.find(1) == my_set.end());
+  ASSERT_FALSE(my_set.contains(1));
+}
+
+TEST(UnorderedSetSuite, insert_erase_test) {
+  unordered_set<int> my_set = {5, 1, 4, 1, 3};
+  ASSERT_TRUE(unordered_sets_equal(my_set, std::set<int>{1, 3, 4, 5}));
+  ASSERT_EQ(*my_set.insert(2).first, 2);
+  ASSERT_FALSE(my_set.insert(2).second);
+  ASSERT_TRUE(my_set.insert(2).first == my_set.end());
+
+  my_set.erase(my_set.find(1));
+  my_set.erase(my_set.find(5));
+  ASSERT_TRUE(unordered_sets_equal(my_set, std::set<int>{2, 3, 4}));
+  ASSERT_EQ(my_set.count(1), 0U);
+  ASSERT_EQ(my_set.count(3), 1U);
+}
+
+// Enough keys for several rehashes, and erases that leave tombstones in
+// full groups as well as slots freed outright
+TEST(UnorderedSetSuite, grow_and_erase_test) {
+  unordered_set<int> my_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 5000; ++i) {
+    int key = i * 7919 % 10007;
+    my_set.insert(key);
+    std_set.insert(key);
+  }
+  for (int i = 0; i < 5000; i += 3) {
+    int key = i * 7919 % 10007;
+    my_set.erase(my_set.find(key));
+    std_set.erase(key);
+  }
+  for (int i = 5000; i < 6000; ++i) {
+    my_set.insert(i * 7919 % 10007);
+    std_set.insert(i * 7919 % 10007);
+  }
+
+  ASSERT_TRUE(unordered_sets_equal(my_set, std_set));
+  for (int key = 0; key < 10007; ++key) {
+    ASSERT_EQ(my_set.contains(key), std_set.count(key) == 1);
+  }
+  ASSERT_LE(my_set.size() * 8, my_set.bucket_count() * 7);
+}
+
+TEST(UnorderedSetSuite, reserve_clear_test) {
+  unordered_set<std::string> my_set;
+  my_set.reserve(100);
+  size_t buckets = my_set.bucket_count();
+  ASSERT_GE(buckets * 7, 100U * 8);
+  for (int i = 0; i < 100; ++i) {
+    my_set.insert(std::to_string(i));
+  }
+  ASSERT_EQ(my_set.bucket_count(), buckets);
+
+  my_set.clear();
+  ASSERT_TRUE(my_set.empty());
+  ASSERT_TRUE(my_set.begin() == my_set.end());
+  ASSERT_FALSE(my_set.contains("42"));
+  my_set.insert("42");
+  ASSERT_TRUE(my_set.contains("42"));
+}
+
+TEST(UnorderedSetSuite, copy_move_swap_merge_test) {
+  unordered_set<int> my_set = {1, 2, 3};
+  unordered_set<int> copy(my_set);
+  copy.insert(4);
+  ASSERT_TRUE(unordered_sets_equal(my_set, std::set<int>{1, 2, 3}));
+  ASSERT_TRUE(unordered_sets_equal(copy, std::set<int>{1, 2, 3, 4}));
+
+  unordered_set<int> moved(std::move(copy));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_EQ(moved.size(), 4U);
+
+  unordered_set<int> other = {3, 5};
+  my_set.merge(other);
+  ASSERT_TRUE(unordered_sets_equal(my_set, std::set<int>{1, 2, 3, 5}));
+  ASSERT_TRUE(unordered_sets_equal(other, std::set<int>{3}));
+
+  my_set.swap(other);
+  ASSERT_TRUE(unordered_sets_equal(my_set, std::set<int>{3}));
+  ASSERT_TRUE(unordered_sets_equal(other, std::set<int>{1, 2, 3, 5}));
+}
+
+}  // namespace s21
@@ -2,7 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "../s21_containers.h"
@@ -359,6 +365,21 @@ TEST(VectorSuite, wrong_insert) {
   ASSERT_THROW(my_vec.insert(my_vec.begin() - 1, 1), std::out_of_range);
 }
 
+TEST(VectorSuite, insert_at_end) {
+  s21::vector<int> my_vec = {1, 2, 3};
+  std::vector<int> std_vec = {1, 2, 3};
+  ASSERT_EQ(*my_vec.insert(my_vec.end(), 4), 4);
+  std_vec.insert(std_vec.end(), 4);
+  int five = 5;
+  my_vec.insert(my_vec.end(), five);
+  std_vec.insert(std_vec.end(), five);
+  ASSERT_EQ(*my_vec.emplace(my_vec.end(), 6), 6);
+  std_vec.emplace(std_vec.end(), 6);
+  ASSERT_TRUE(std::equal(my_vec.begin(), my_vec.end(), std_vec.begin(),
+                         std_vec.end()));
+  ASSERT_THROW(my_vec.emplace(my_vec.end() + 1, 7), std::out_of_range);
+}
+
 TEST(VectorSuite, insert_empty) {
   s21::vector<int> my_vec;
   std::vector<int> std_vec;
@@ -431,3 +452,233 @@ TEST(VectorSuite, extra_default_constructors) {
   ASSERT_TRUE(vectors_equal(std_vec, my_vec));
   ASSERT_THROW(my_vec.at(30), std::out_of_range);
 }
+
+// No default constructor, and every live object is counted
+struct tracked {
+  explicit tracked(int value) : value_(value) { ++alive; }
+  tracked(const tracked &other) : value_(other.value_) { ++alive; }
+  tracked &operator=(const tracked &other) = default;
+  ~tracked() { --alive; }
+
+  int value_;
+  static inline int alive = 0;
+};
+
+TEST(VectorSuite, raw_storage) {
+  {
+    s21::vector<tracked> my_vec;
+    my_vec.reserve(100);
+    ASSERT_EQ(tracked::alive, 0);
+
+    for (int i = 0; i < 10; ++i) {
+      my_vec.push_back(tracked(i));
+    }
+    my_vec.insert(my_vec.begin(), my_vec.back());
+    my_vec.push_back(my_vec.front());
+    ASSERT_EQ(tracked::alive, 12);
+    ASSERT_EQ(my_vec.front().value_, 9);
+    ASSERT_EQ(my_vec.back().value_, 9);
+
+    my_vec.erase(my_vec.begin() + 1);
+    my_vec.pop_back();
+    ASSERT_EQ(tracked::alive, 10);
+    my_vec.shrink_to_fit();
+    ASSERT_EQ(my_vec.capacity(), 10U);
+    s21::vector<tracked> copy(my_vec);
+    ASSERT_EQ(tracked::alive, 20);
+    copy.clear();
+    ASSERT_EQ(tracked::alive, 10);
+  }
+  ASSERT_EQ(tracked::alive, 0);
+}
+
+// Counts copies made by the vector, moves are free unless they may throw
+template <bool kNoexceptMove>
+struct relocated {
+  relocated() = default;
+  relocated(const relocated &) { ++copies; }
+  relocated(relocated &&) noexcept(kNoexceptMove) {}
+  relocated &operator=(const relocated &) = default;
+  relocated &operator=(relocated &&) = default;
+
+  static inline int copies = 0;
+};
+
+TEST(VectorSuite, growth_moves_if_noexcept) {
+  s21::vector<relocated<true>> moved;
+  s21::vector<relocated<false>> copied;
+  relocated<true> movable;
+  relocated<false> copyable;
+  for (int i = 0; i < 100; ++i) {
+    moved.push_back(movable);
+    copied.push_back(copyable);
+  }
+
+  // one copy per push_back, growth adds none
+  ASSERT_EQ(relocated<true>::copies, 100);
+  // 1 + 2 + ... + 64 more copied by the eight reallocations
+  ASSERT_EQ(relocated<false>::copies, 100 + 127);
+}
+
+// Owns a heap int: not trivially copyable, but safe to move as bytes
+struct boxed {
+  explicit boxed(int value) : value_(new int(value)) {}
+  boxed(const boxed &other) : value_(new int(*other.value_)) {}
+  boxed &operator=(const boxed &other) {
+    *value_ = *other.value_;
+    return *this;
+  }
+  ~boxed() { delete value_; }
+
+  int *value_;
+};
+
+template <>
+struct s21::is_trivially_relocatable<boxed> : std::true_type {};
+
+TEST(VectorSuite, trivially_relocatable) {
+  s21::vector<boxed> my_vec;
+  std::vector<int> std_vec;
+  for (int i = 0; i < 20; ++i) {
+    my_vec.push_back(boxed(i));
+    std_vec.push_back(i);
+  }
+  my_vec.insert(my_vec.begin() + 5, my_vec[7]);
+  std_vec.insert(std_vec.begin() + 5, std_vec[7]);
+  my_vec.insert(my_vec.begin(), boxed(-1));
+  std_vec.insert(std_vec.begin(), -1);
+  my_vec.erase(my_vec.begin() + 3);
+  std_vec.erase(std_vec.begin() + 3);
+  my_vec.shrink_to_fit();
+  s21::vector<boxed> copy = my_vec;
+
+  ASSERT_EQ(copy.size(), std_vec.size());
+  for (size_t i = 0; i < std_vec.size(); ++i) {
+    ASSERT_EQ(*my_vec[i].value_, std_vec[i]);
+    ASSERT_EQ(*copy[i].value_, std_vec[i]);
+  }
+}
+
+TEST(VectorSuite, emplace_and_insert_many) {
+  s21::vector<std::string> my_vec;
+  std::vector<std::string> std_vec;
+  my_vec.emplace_back(3U, 'a');
+  std_vec.emplace_back(3U, 'a');
+  my_vec.emplace(my_vec.begin(), "b");
+  std_vec.emplace(std_vec.cbegin(), "b");
+  auto first = my_vec.insert_many(my_vec.begin() + 1, "c", my_vec[0]);
+  ASSERT_EQ(first, my_vec.begin() + 1);
+  std_vec.insert(std_vec.cbegin() + 1, {"c", std_vec[0]});
+  my_vec.insert_many_back(std::string(2, 'd'), "e");
+  std_vec.insert(std_vec.cend(), {std::string(2, 'd'), "e"});
+  ASSERT_EQ(my_vec.insert_many(my_vec.end()), my_vec.end());
+  ASSERT_TRUE(vectors_equal(std_vec, my_vec));
+
+  s21::vector<std::unique_ptr<int>> owners;
+  owners.push_back(std::make_unique<int>(2));
+  owners.insert(owners.begin(), std::make_unique<int>(0));
+  owners.insert_many(owners.begin() + 1, std::make_unique<int>(1));
+  ASSERT_EQ(*owners.emplace_back(new int(3)), 3);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(*owners[size_t(i)], i);
+  }
+}
+
+TEST(VectorSuite, range_insert_and_erase) {
+  s21::vector<std::string> my_vec;
+  std::vector<std::string> std_vec;
+  std::vector<std::string> items = {"a", "b", "c"};
+  my_vec.insert(my_vec.begin(), items.begin(), items.end());
+  std_vec.insert(std_vec.begin(), items.begin(), items.end());
+  my_vec.insert(my_vec.begin() + 1, 2, my_vec[2]);
+  std_vec.insert(std_vec.begin() + 1, 2, std_vec[2]);
+  auto inserted = my_vec.insert(my_vec.end(), items.rbegin(), items.rend());
+  std_vec.insert(std_vec.end(), items.rbegin(), items.rend());
+  ASSERT_EQ(*inserted, "c");
+  ASSERT_TRUE(std::equal(my_vec.begin(), my_vec.end(), std_vec.begin(),
+                         std_vec.end()));
+
+  ASSERT_EQ(*my_vec.erase(my_vec.begin() + 1, my_vec.begin() + 4), "c");
+  std_vec.erase(std_vec.begin() + 1, std_vec.begin() + 4);
+  my_vec.erase(my_vec.end(), my_vec.end());
+  ASSERT_TRUE(std::equal(my_vec.begin(), my_vec.end(), std_vec.begin(),
+                         std_vec.end()));
+
+  // single pass input
+  std::istringstream words("x y");
+  my_vec.insert(my_vec.begin() + 1, std::istream_iterator<std::string>(words),
+                std::istream_iterator<std::string>());
+  std_vec.insert(std_vec.begin() + 1, {"x", "y"});
+  ASSERT_TRUE(std::equal(my_vec.begin(), my_vec.end(), std_vec.begin(),
+                         std_vec.end()));
+  ASSERT_THROW(my_vec.erase(my_vec.end(), my_vec.begin()), std::out_of_range);
+  ASSERT_THROW(my_vec.insert(my_vec.end() + 1, 1, "x"), std::out_of_range);
+}
+
+TEST(VectorSuite, erase_if) {
+  {
+    s21::vector<tracked> my_vec;
+    for (int i = 0; i < 20; ++i) {
+      my_vec.push_back(tracked(i));
+    }
+    auto removed = s21::erase_if(
+        my_vec, [](const tracked &item) { return item.value_ % 3 != 0; });
+    ASSERT_EQ(removed, 13U);
+    ASSERT_EQ(my_vec.size(), 7U);
+    ASSERT_EQ(tracked::alive, 7);
+    for (size_t i = 0; i < my_vec.size(); ++i) {
+      ASSERT_EQ(my_vec[i].value_, int(i) * 3);
+    }
+  }
+  ASSERT_EQ(tracked::alive, 0);
+
+  s21::vector<int> numbers = {1, 2, 3, 4};
+  ASSERT_EQ(s21::erase_if(numbers, [](int value) { return value > 2; }), 2U);
+  ASSERT_EQ(numbers.size(), 2U);
+  ASSERT_EQ(numbers.back(), 2);
+}
+
+// Throws when built from a negative int, counts live objects and moves
+struct fragile {
+  explicit fragile(int value) : value_(value) {
+    if (value < 0) {
+      throw std::invalid_argument("negative");
+    }
+    ++alive;
+  }
+  fragile(const fragile &other) : value_(other.value_) { ++alive; }
+  fragile(fragile &&other) noexcept : value_(other.value_) {
+    ++alive;
+    ++moves;
+  }
+  fragile &operator=(const fragile &other) = default;
+  fragile &operator=(fragile &&other) = default;
+  ~fragile() { --alive; }
+
+  int value_;
+  static inline int alive = 0;
+  static inline int moves = 0;
+};
+
+TEST(VectorSuite, insert_many_strong_guarantee) {
+  s21::vector<fragile> my_vec;
+  my_vec.reserve(8);
+  my_vec.emplace_back(1);
+  my_vec.emplace_back(2);
+  my_vec.insert_many_back(3, 4);
+  ASSERT_EQ(fragile::moves, 0);
+
+  ASSERT_THROW(my_vec.insert_many(my_vec.begin(), 7, -1, 9),
+               std::invalid_argument);
+  ASSERT_EQ(my_vec.size(), 4U);
+  ASSERT_EQ(fragile::alive, 4);
+  my_vec.shrink_to_fit();
+  ASSERT_THROW(my_vec.insert_many(my_vec.begin() + 1, 7, -1),
+               std::invalid_argument);
+  ASSERT_EQ(my_vec.size(), 4U);
+  ASSERT_EQ(my_vec.capacity(), 4U);
+  ASSERT_EQ(fragile::alive, 4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(my_vec[size_t(i)].value_, i + 1);
+  }
+}